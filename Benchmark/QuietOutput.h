@@ -0,0 +1,71 @@
+/**
+ * Helpers shared by every bench_<pattern> binary.
+ * Most of the pattern classes report what they do through std::cout, so while a benchmark is running the output
+ * is sent into a sink instead of the terminal. The formatting cost stays in the measurement, the terminal cost does not.
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ */
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <iostream>
+#include <streambuf>
+#include <string_view>
+
+// Stream buffer that accepts and drops everything written into it.
+class NullBuffer : public std::streambuf
+{
+    protected:
+    int overflow(int c) override { return traits_type::not_eof(c); }
+    std::streamsize xsputn(const char*, std::streamsize count) override { return count; }
+};
+
+// Redirects std::cout into a NullBuffer for as long as the object lives.
+class QuietOutput
+{
+    private:
+    NullBuffer sink_;
+    std::streambuf* previous_;
+    public:
+    QuietOutput() : sink_(), previous_(std::cout.rdbuf(&sink_)) {}
+    QuietOutput(const QuietOutput&) = delete;
+    QuietOutput& operator=(const QuietOutput&) = delete;
+    ~QuietOutput() { std::cout.rdbuf(previous_); }
+};
+
+// NullBuffer that also counts the writes starting with a given text. The pattern classes write each message with
+// one operator<<, so this counts messages - from any number of threads, the counter is atomic.
+class CountingBuffer : public NullBuffer
+{
+    private:
+    std::string_view prefix_;
+    std::atomic<std::size_t> count_;
+    protected:
+    std::streamsize xsputn(const char* text, std::streamsize count) override
+    {
+        if(std::string_view(text, static_cast<std::size_t>(count)).substr(0, prefix_.size()) == prefix_)
+        {
+            count_.fetch_add(1, std::memory_order_relaxed);
+        }
+        return count;
+    }
+    public:
+    explicit CountingBuffer(std::string_view prefix) : prefix_(prefix), count_(0) {}
+    std::size_t count() const { return count_.load(std::memory_order_relaxed); }
+};
+
+// Redirects std::cout into a CountingBuffer for as long as the object lives.
+class CountedOutput
+{
+    private:
+    CountingBuffer sink_;
+    std::streambuf* previous_;
+    public:
+    explicit CountedOutput(std::string_view prefix) : sink_(prefix), previous_(std::cout.rdbuf(&sink_)) {}
+    CountedOutput(const CountedOutput&) = delete;
+    CountedOutput& operator=(const CountedOutput&) = delete;
+    ~CountedOutput() { std::cout.rdbuf(previous_); }
+    std::size_t count() const { return sink_.count(); }
+};
@@ -0,0 +1,27 @@
+// Benchmarks of the Chain of Responsibility hot call: CanteenHandle::handle, for a request handled at each link of the chain.
+#include <benchmark/benchmark.h>
+#include "Chain.h"
+#include "QuietOutput.h"
+
+static void benchHandle(benchmark::State& state)
+{
+    QuietOutput quiet;
+    AmyHandler amy;
+    MattHandler matt;
+    PeterHandler peter;
+    amy.setNext(&matt);
+    matt.setNext(&peter);
+    peter.setNext(nullptr);
+    CanteenHandle* firstCustomer = &amy;
+
+    // 0 - eaten by Amy, 1 - eaten by Matt, 2 - eaten by Peter
+    Food meals[] = {Food(false, false), Food(true, false), Food(false, true)};
+    Food* tray = &meals[state.range(0)];
+    for(auto _ : state)
+    {
+        benchmark::DoNotOptimize(firstCustomer->handle(tray));
+    }
+}
+BENCHMARK(benchHandle)->DenseRange(0, 2);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,115 @@
+/**
+ * Classes of the Command example, shared by the demo (main.cpp) and its benchmark (bench.cpp).
+ * The pattern itself is described in the header of main.cpp.
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ */
+#pragma once
+
+#include<iostream>
+#include<vector>
+#include<string>
+
+// This is an example of Command design pattern of an text editor.
+// Command receiver
+class TextEditor
+{
+    public: 
+    std::string text_;
+    TextEditor() { text_ = ""; }
+    void deleteSegment(std::string segment)
+    {
+        size_t isInText = text_.find(segment);
+        if(isInText != std::string::npos)
+        {
+            text_.erase(isInText, segment.size());
+        }
+        else
+        {
+            std::cout << "No \"" << segment << "\" in text" << std::endl;
+        }
+    }
+    void addSegment(std::string segment)
+    {
+        text_ += segment;
+    }
+};
+
+// Interface command
+class Command
+{
+    protected:
+    TextEditor* currentEditor_;
+    std::string text_;
+    public:
+    Command(TextEditor* editor, std::string optionalText = "") : currentEditor_(editor), text_(optionalText) {}
+    virtual bool execute() = 0;
+    virtual void undo() = 0;
+    virtual ~Command() {}
+};
+
+// The following are the concrete commands.
+// The concrete command does not do the logic inside them, they mostly execute a different methods/functions
+class CutCommand : public Command
+{
+    public:
+    CutCommand(TextEditor* editor, std::string optionalText = "") : Command(editor, optionalText) {}
+    bool execute() override
+    {
+        currentEditor_->deleteSegment(Command::text_);
+        return 1;
+    }
+    void undo() override
+    {
+        currentEditor_->addSegment(Command::text_);
+    }
+};
+
+// Another concrete command
+class InsertCommand : public Command
+{
+    public:
+    InsertCommand(TextEditor* editor, std::string optionalText = "") : Command (editor, optionalText) {}
+    bool execute() override
+    {
+        currentEditor_->addSegment(Command::text_);
+        return 1;
+    }
+    void undo() override
+    {
+        currentEditor_->deleteSegment(Command::text_);
+    }
+};
+
+// This will be a storage used for undo.
+class CommandHistory
+{
+    private:
+    std::vector<Command*> listOfCommands_;
+    public:
+    void push(Command* newCommand) { listOfCommands_.push_back(newCommand); }
+    Command* pop() 
+    {
+        if(listOfCommands_.empty())
+        {
+            return nullptr;
+        }
+
+        Command* lastCommand = listOfCommands_[listOfCommands_.size() - 1];
+        listOfCommands_.pop_back(); 
+        return lastCommand;
+    }
+    void clear() { listOfCommands_.clear(); }
+};
+
+// Command invoker 
+class Button
+{
+    private:
+    Command* buttonType_;
+    public:
+    Button(Command* commandType) : buttonType_(commandType) {}
+    void setButton(Command* newCommand) { buttonType_ = newCommand; } 
+    Command* press() { return buttonType_; }
+};
@@ -0,0 +1,38 @@
+// Benchmarks of the Command hot calls: executing and undoing commands through the Command interface.
+#include <benchmark/benchmark.h>
+#include "Command.h"
+
+static void benchExecuteUndo(benchmark::State& state)
+{
+    TextEditor editor;
+    editor.text_ = "Hello ";
+    InsertCommand insert(&editor, "world!");
+    Command* command = &insert;
+    for(auto _ : state)
+    {
+        command->execute();
+        command->undo();
+    }
+    benchmark::DoNotOptimize(editor.text_);
+}
+BENCHMARK(benchExecuteUndo);
+
+static void benchHistory(benchmark::State& state)
+{
+    TextEditor editor;
+    InsertCommand insert(&editor, "a");
+    CommandHistory history;
+    for(auto _ : state)
+    {
+        if(insert.execute())
+        {
+            history.push(&insert);
+        }
+        Command* last = history.pop();
+        last->undo();
+    }
+    benchmark::DoNotOptimize(editor.text_);
+}
+BENCHMARK(benchHistory);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,57 @@
+// Benchmarks of the Iterator hot calls: walking a shelf with both iterators.
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <vector>
+#include "Iterator.h"
+
+static std::vector<Book*> fillShelf(int count)
+{
+    std::vector<Book*> books;
+    for(int i = 0; i < count; ++i)
+    {
+        books.push_back(new Book(i % 2 ? "Literature" : "Fantasy", "Volume"));
+    }
+    return books;
+}
+
+static void benchGeneralIterator(benchmark::State& state)
+{
+    std::vector<Book*> books = fillShelf(static_cast<int>(state.range(0)));
+    GeneralBookShelf shelf(books);
+    for(auto _ : state)
+    {
+        std::unique_ptr<Iterator> it(shelf.createGeneralIterator());
+        while(!it->isLast())
+        {
+            benchmark::DoNotOptimize(it->getCurrent());
+            it->goNext();
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    for(auto book : books) { delete book; }
+}
+BENCHMARK(benchGeneralIterator)->Arg(1 << 10);
+
+static void benchLiteratureIterator(benchmark::State& state)
+{
+    std::vector<Book*> books = fillShelf(static_cast<int>(state.range(0)));
+    GeneralBookShelf shelf(books);
+    for(auto _ : state)
+    {
+        std::unique_ptr<Iterator> it(shelf.createLiteratureIterator());
+        while(!it->isLast())
+        {
+            Book* current = it->getCurrent();
+            benchmark::DoNotOptimize(current);
+            if(current)
+            {
+                it->goNext();
+            }
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    for(auto book : books) { delete book; }
+}
+BENCHMARK(benchLiteratureIterator)->Arg(1 << 10);
+
+BENCHMARK_MAIN();
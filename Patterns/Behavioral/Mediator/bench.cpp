@@ -0,0 +1,33 @@
+// Benchmarks of the Mediator hot call: Mediator::notify, driven by a passenger requesting and cancelling rides.
+#include <benchmark/benchmark.h>
+#include "Mediator.h"
+#include "QuietOutput.h"
+
+static void benchRequestCancel(benchmark::State& state)
+{
+    QuietOutput quiet;
+    RideMediator mediator;
+    CasualDriver driver(&mediator, "John");
+    CasualPassager passenger(&mediator, "Fyodor", "Russian St. 1");
+    for(auto _ : state)
+    {
+        passenger.cancelRide();
+        passenger.requestRide();
+    }
+}
+BENCHMARK(benchRequestCancel);
+
+static void benchChangePickup(benchmark::State& state)
+{
+    QuietOutput quiet;
+    RideMediator mediator;
+    PetDriver driver(&mediator, "Todd");
+    PetPassager passenger(&mediator, "Mark", "Industrail St. 23");
+    for(auto _ : state)
+    {
+        passenger.changePickup("Industrial St. 23");
+    }
+}
+BENCHMARK(benchChangePickup);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,21 @@
+// Benchmarks of the Memento hot calls: taking and restoring a snapshot of the originator.
+#include <benchmark/benchmark.h>
+#include <string>
+#include "Memento.h"
+#include "QuietOutput.h"
+
+static void benchSaveRestore(benchmark::State& state)
+{
+    QuietOutput quiet;
+    TextEditor editor;
+    editor.setContent(std::string(state.range(0), 'a'));
+    for(auto _ : state)
+    {
+        TextEditor::Memento* snapshot = editor.save();
+        editor.restore(snapshot);
+        delete snapshot;
+    }
+}
+BENCHMARK(benchSaveRestore)->Arg(16)->Arg(4096);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,27 @@
+// Benchmarks of the Observer hot call: Service::notify fanning out to every subscriber.
+#include <benchmark/benchmark.h>
+#include <vector>
+#include "Observer.h"
+#include "QuietOutput.h"
+
+static void benchNotify(benchmark::State& state)
+{
+    QuietOutput quiet;
+    Tweetch tweetch;
+    Service* service = &tweetch;
+    std::vector<Subscriber*> subs;
+    for(int i = 0; i < state.range(0); ++i)
+    {
+        subs.push_back(i % 2 ? static_cast<Subscriber*>(new PhoneSub) : new ComputerSub);
+        service->addSub(subs.back());
+    }
+    for(auto _ : state)
+    {
+        service->notify("Goin' live with da bois!");
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    for(auto sub : subs) { delete sub; }
+}
+BENCHMARK(benchNotify)->Arg(1)->Arg(64)->Arg(1024);
+
+BENCHMARK_MAIN();
@@ -11,105 +11,7 @@
 #include<vector>
 #include<algorithm>
 #include<time.h>
-
-// Subsriber interface
-class Subscriber
-{
-    public:
-    virtual void update(std::string message) = 0;
-    virtual ~Subscriber() = default; 
-};
-
-// Concrete Subscriber
-class ComputerSub : public Subscriber
-{
-    public:
-    void update(std::string message) override
-    { std::cout << "Notification pops on the monitor. It says " << message << std::endl; }
-};
-
-// Concrete subsriber
-class PhoneSub : public Subscriber
-{
-    public:
-    void update(std::string message) override
-    { std::cout << "Push notification appeared, with text: " << message << std::endl; }
-};
-
-// Publisher Interface
-class Service
-{
-    protected:
-    std::vector<Subscriber*> subList_;
-    public:
-    virtual void addSub(Subscriber* subNew) { this->subList_.push_back(subNew); }
-    virtual void removeSub(Subscriber* subRem)  
-    {
-        this->subList_.erase(std::remove(this->subList_.begin(), this->subList_.end(), subRem), this->subList_.end());
-
-    }
-    virtual void notify(std::string customMessage = "") = 0;
-    virtual ~Service() { this->subList_.clear(); };
-};
-
-// Concrete Publisher
-class Tweetch : public Service
-{
-    public:
-    void notify(std::string customMessage = "")  override
-    {
-        std::string finalMessage = "Tweetch: ";
-        customMessage.empty() ? finalMessage += "Someone just went live!" : finalMessage += customMessage;
-        for(auto sub : this->subList_)
-        {
-            sub->update(finalMessage);
-        }
-    }
-
-};
-
-// Concrete Publisher - just like suberibers, publishers can also have an interface to implement and follow
-class YouPipe : public Service
-{
-    public:
-    void notify(std::string customMessage = "") override
-    {
-        std::string finalMessage = "YouPipe: ";
-        customMessage.empty() ? finalMessage += "Someone just uploaded a new video!" : finalMessage += customMessage;
-        for(auto sub : this->subList_)
-        {
-            sub->update(finalMessage);
-        }
-    }
-};
-
-// Event caller - this could (and should!) be also implemented as a interface
-class ContentCreator
-{
-    private:
-    std::string channelName_;
-    Service* targetSite_;
-    uint32_t subCount_;
-    public:
-    ContentCreator(std::string channelName, Service* targetSite) : channelName_(channelName), targetSite_(targetSite), subCount_(0) {}
-    void makeContent(std::string action)
-    {
-        std::string channelPrefix = this->channelName_ + " ";
-        targetSite_->notify(channelPrefix + action);
-    }
-    void giveSub(Subscriber* interesant)
-    {
-        ++subCount_;
-        targetSite_->addSub(interesant);
-    }
-    void takeSub(Subscriber* interesant)
-    {
-        --subCount_;
-        targetSite_->removeSub(interesant);
-    }
-    void showStats()
-    { std::cout << "Channel: " << this->channelName_ << " with: " << this->subCount_ << " subsribers." << std::endl; }
-};
+#include "Observer.h"
 
 // Client code
 int main()
@@ -0,0 +1,30 @@
+// Benchmarks of the State hot calls: requests handled by the current state and state transitions.
+#include <benchmark/benchmark.h>
+#include "State.h"
+#include "QuietOutput.h"
+
+static void benchDrive(benchmark::State& state)
+{
+    QuietOutput quiet;
+    Car car;
+    car.turnOn();
+    for(auto _ : state)
+    {
+        car.travel("Berlin");
+    }
+}
+BENCHMARK(benchDrive);
+
+static void benchTransition(benchmark::State& state)
+{
+    QuietOutput quiet;
+    Car car;
+    for(auto _ : state)
+    {
+        car.turnOn();
+        car.turnOff();
+    }
+}
+BENCHMARK(benchTransition);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,19 @@
+// Benchmarks of the Strategy hot call: Battle::fightBattle choosing and running a strategy.
+#include <benchmark/benchmark.h>
+#include "Strategy.h"
+#include "QuietOutput.h"
+
+static void benchFightBattle(benchmark::State& state)
+{
+    QuietOutput quiet;
+    LeadingCommander leader("Jonathan Smith", CommanderTraits::defensiveLeader);
+    Army army(13200, &leader);
+    Battle battle(&army);
+    for(auto _ : state)
+    {
+        battle.fightBattle();
+    }
+}
+BENCHMARK(benchFightBattle);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,18 @@
+// Benchmarks of the Template method hot call: Sandwitch::assamble.
+#include <benchmark/benchmark.h>
+#include "Template.h"
+#include "QuietOutput.h"
+
+static void benchAssamble(benchmark::State& state)
+{
+    QuietOutput quiet;
+    FrenchSandwitch french;
+    Sandwitch* sandwitch = &french;
+    for(auto _ : state)
+    {
+        sandwitch->assamble();
+    }
+}
+BENCHMARK(benchAssamble);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,25 @@
+// Benchmarks of the Visitor hot call: double dispatch through Goverment::accept.
+#include <benchmark/benchmark.h>
+#include <vector>
+#include "Visitor.h"
+#include "QuietOutput.h"
+
+static void benchAccept(benchmark::State& state)
+{
+    QuietOutput quiet;
+    Republic venice(45, "Venice");
+    Tribe helensky(40, "Helensky");
+    Kingdom tchwabia(50, "Tchwabia");
+    std::vector<Goverment*> countryBlobs = {&venice, &helensky, &tchwabia};
+    rulerKill visitor;
+    for(auto _ : state)
+    {
+        for(auto blob : countryBlobs)
+        {
+            blob->accept(&visitor);
+        }
+    }
+}
+BENCHMARK(benchAccept);
+
+BENCHMARK_MAIN();
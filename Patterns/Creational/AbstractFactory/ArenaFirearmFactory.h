@@ -0,0 +1,90 @@
+/**
+ * Arena backed variant of the firearm factory. Instead of a heap new/delete pair per product, every family member is
+ * constructed in place inside a monotonic buffer owned by the factory. Products are handed out as owning handles
+ * that only run the destructor, the memory itself is given back for the whole batch at once with reset().
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ */
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include "AbstractFactory.h"
+
+// Destroys a product that lives inside an arena, without freeing its memory.
+struct ArenaDelete
+{
+    template<typename Product>
+    void operator()(Product* product) const { product->~Product(); }
+};
+
+using PistolHandle = std::unique_ptr<Pistol, ArenaDelete>;
+using RifleHandle = std::unique_ptr<Rifle, ArenaDelete>;
+
+// Abstract arena factory
+class ArenaFirearmFactory
+{
+    private:
+    std::pmr::monotonic_buffer_resource arena_;
+
+    protected:
+    template<typename Product>
+    Product* construct()
+    { return new (arena_.allocate(sizeof(Product), alignof(Product))) Product; }
+
+    public:
+    // The arena grabs its blocks from upstream, by default the global heap.
+    explicit ArenaFirearmFactory(std::pmr::memory_resource* upstream = std::pmr::get_default_resource()) : arena_(upstream) {}
+    // Reserves room for the first batch up front.
+    ArenaFirearmFactory(std::size_t initialSize, std::pmr::memory_resource* upstream = std::pmr::get_default_resource()) : arena_(initialSize, upstream) {}
+    ArenaFirearmFactory(const ArenaFirearmFactory&) = delete;
+    ArenaFirearmFactory& operator=(const ArenaFirearmFactory&) = delete;
+
+    // Create weaponry
+    virtual PistolHandle createPistol() = 0;
+    virtual RifleHandle createRifle() = 0;
+
+    // Use weaponry - the products are destroyed at the end, their memory is reclaimed by the next reset().
+    void presentFirearm()
+    {
+        PistolHandle concretePistol = createPistol();
+        RifleHandle concreteRifle = createRifle();
+
+        concretePistol->present();
+        concretePistol->shoot();
+
+        concreteRifle->present();
+        concreteRifle->shoot();
+    }
+
+    /// @brief Releases every product created so far in one go.
+    /// @note All handles from this factory have to be destroyed before calling it.
+    void reset() { arena_.release(); }
+
+    virtual ~ArenaFirearmFactory() {}
+};
+
+// Concrete vintage arena factory
+class VintageArenaFirearmFactory : public ArenaFirearmFactory
+{
+    public:
+    using ArenaFirearmFactory::ArenaFirearmFactory;
+    PistolHandle createPistol() override
+    { return PistolHandle(construct<VintagePistol>()); }
+    RifleHandle createRifle() override
+    { return RifleHandle(construct<VintageRifle>()); }
+};
+
+// Concrete modern arena factory
+class ModernArenaFirearmFactory : public ArenaFirearmFactory
+{
+    public:
+    using ArenaFirearmFactory::ArenaFirearmFactory;
+    PistolHandle createPistol() override
+    { return PistolHandle(construct<ModernPistol>()); }
+    RifleHandle createRifle() override
+    { return RifleHandle(construct<ModernRifle>()); }
+};
@@ -0,0 +1,63 @@
+/**
+ * Compile time variant of the firearm factory. The product family is a policy, so the factory returns the concrete
+ * products by value - they can live on the stack and every call on them is resolved (and inlined) at compile time.
+ * When the family is only known at runtime, AnyStaticFirearmFactory keeps the choice in a std::variant and
+ * dispatches once per call through std::visit instead of once per product method.
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ */
+#pragma once
+
+#include <variant>
+#include "AbstractFactory.h"
+
+// Product family policies
+struct ModernFamily
+{
+    using PistolType = ModernPistol;
+    using RifleType = ModernRifle;
+};
+
+struct VintageFamily
+{
+    using PistolType = VintagePistol;
+    using RifleType = VintageRifle;
+};
+
+// Policy based factory
+template<typename Family>
+class StaticFirearmFactory
+{
+    public:
+    using PistolType = typename Family::PistolType;
+    using RifleType = typename Family::RifleType;
+
+    // Create weaponry
+    PistolType createPistol() const { return PistolType(); }
+    RifleType createRifle() const { return RifleType(); }
+
+    // Use weaponry
+    void presentFirearm() const
+    {
+        PistolType concretePistol = createPistol();
+        RifleType concreteRifle = createRifle();
+
+        concretePistol.present();
+        concretePistol.shoot();
+
+        concreteRifle.present();
+        concreteRifle.shoot();
+    }
+};
+
+using ModernStaticFirearmFactory = StaticFirearmFactory<ModernFamily>;
+using VintageStaticFirearmFactory = StaticFirearmFactory<VintageFamily>;
+
+// Runtime selected family over the closed set of static factories.
+using AnyStaticFirearmFactory = std::variant<ModernStaticFirearmFactory, VintageStaticFirearmFactory>;
+
+inline void presentFirearm(const AnyStaticFirearmFactory& factory)
+{
+    std::visit([](const auto& concreteFactory) { concreteFactory.presentFirearm(); }, factory);
+}
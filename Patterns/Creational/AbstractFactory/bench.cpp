@@ -0,0 +1,162 @@
+// Benchmarks of the Abstract factory hot calls: product creation through the factory interface and a full presentation.
+#include <benchmark/benchmark.h>
+#include <memory>
+#include "AbstractFactory.h"
+#include "ArenaFirearmFactory.h"
+#include "StaticFirearmFactory.h"
+#include "QuietOutput.h"
+
+static void benchCreatePistol(benchmark::State& state)
+{
+    std::unique_ptr<FirearmFactory> factory(new ModernFirearmFactory);
+    for(auto _ : state)
+    {
+        Pistol* product = factory->createPistol();
+        benchmark::DoNotOptimize(product);
+        delete product;
+    }
+}
+BENCHMARK(benchCreatePistol);
+
+static void benchCreateFamily(benchmark::State& state)
+{
+    std::unique_ptr<FirearmFactory> factory(new VintageFirearmFactory);
+    for(auto _ : state)
+    {
+        Pistol* pistol = factory->createPistol();
+        Rifle* rifle = factory->createRifle();
+        benchmark::DoNotOptimize(pistol);
+        benchmark::DoNotOptimize(rifle);
+        delete pistol;
+        delete rifle;
+    }
+}
+BENCHMARK(benchCreateFamily);
+
+static void benchPresentFirearm(benchmark::State& state)
+{
+    QuietOutput quiet;
+    std::unique_ptr<FirearmFactory> factory(new ModernFirearmFactory);
+    for(auto _ : state)
+    {
+        factory->presentFirearm();
+    }
+}
+BENCHMARK(benchPresentFirearm);
+
+// A batch of state.range(0) families, each pistol and rifle created and dropped like in presentFirearm.
+static void benchBatchNewDelete(benchmark::State& state)
+{
+    std::unique_ptr<FirearmFactory> factory(new ModernFirearmFactory);
+    for(auto _ : state)
+    {
+        for(int64_t i = 0; i < state.range(0); ++i)
+        {
+            Pistol* pistol = factory->createPistol();
+            Rifle* rifle = factory->createRifle();
+            benchmark::DoNotOptimize(pistol);
+            benchmark::DoNotOptimize(rifle);
+            delete pistol;
+            delete rifle;
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0) * 2);
+}
+BENCHMARK(benchBatchNewDelete)->Arg(1000000)->Unit(benchmark::kMillisecond);
+
+// The same batch in an arena, released with a single reset() at the end.
+static void benchBatchArena(benchmark::State& state)
+{
+    ModernArenaFirearmFactory factory;
+    for(auto _ : state)
+    {
+        for(int64_t i = 0; i < state.range(0); ++i)
+        {
+            PistolHandle pistol = factory.createPistol();
+            RifleHandle rifle = factory.createRifle();
+            benchmark::DoNotOptimize(pistol.get());
+            benchmark::DoNotOptimize(rifle.get());
+        }
+        factory.reset();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0) * 2);
+}
+BENCHMARK(benchBatchArena)->Arg(1000000)->Unit(benchmark::kMillisecond);
+
+// Arena sized for the whole batch up front - one upstream allocation per batch.
+static void benchBatchArenaPresized(benchmark::State& state)
+{
+    ModernArenaFirearmFactory factory(static_cast<std::size_t>(state.range(0)) * (sizeof(ModernPistol) + sizeof(ModernRifle)));
+    for(auto _ : state)
+    {
+        for(int64_t i = 0; i < state.range(0); ++i)
+        {
+            PistolHandle pistol = factory.createPistol();
+            RifleHandle rifle = factory.createRifle();
+            benchmark::DoNotOptimize(pistol.get());
+            benchmark::DoNotOptimize(rifle.get());
+        }
+        factory.reset();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0) * 2);
+}
+BENCHMARK(benchBatchArenaPresized)->Arg(1000000)->Unit(benchmark::kMillisecond);
+
+// Dispatch cost: the same create + present + shoot through the virtual hierarchy, the static factory and the variant.
+static void benchDispatchVirtual(benchmark::State& state)
+{
+    QuietOutput quiet;
+    std::unique_ptr<FirearmFactory> factory(new ModernFirearmFactory);
+    for(auto _ : state)
+    {
+        Pistol* pistol = factory->createPistol();
+        pistol->present();
+        pistol->shoot();
+        delete pistol;
+    }
+}
+BENCHMARK(benchDispatchVirtual);
+
+static void benchDispatchStatic(benchmark::State& state)
+{
+    QuietOutput quiet;
+    ModernStaticFirearmFactory factory;
+    for(auto _ : state)
+    {
+        ModernPistol pistol = factory.createPistol();
+        pistol.present();
+        pistol.shoot();
+    }
+}
+BENCHMARK(benchDispatchStatic);
+
+static void benchDispatchVariant(benchmark::State& state)
+{
+    QuietOutput quiet;
+    AnyStaticFirearmFactory factory = ModernStaticFirearmFactory();
+    benchmark::DoNotOptimize(factory);
+    for(auto _ : state)
+    {
+        std::visit([](const auto& concreteFactory)
+        {
+            auto pistol = concreteFactory.createPistol();
+            pistol.present();
+            pistol.shoot();
+        }, factory);
+    }
+}
+BENCHMARK(benchDispatchVariant);
+
+// Creation only, with the product kept opaque so the compiler cannot drop it.
+static void benchCreateStatic(benchmark::State& state)
+{
+    ModernStaticFirearmFactory factory;
+    for(auto _ : state)
+    {
+        ModernPistol pistol = factory.createPistol();
+        benchmark::DoNotOptimize(pistol);
+    }
+}
+BENCHMARK(benchCreateStatic);
+
+BENCHMARK_MAIN();
@@ -8,134 +8,44 @@
  * 
  */
 #include <iostream>
+#include "AbstractFactory.h"
+#include "ArenaFirearmFactory.h"
+#include "StaticFirearmFactory.h"
 
-// Abstraction of Pistol
-class Pistol
-{
-    public:
-    virtual void shoot() = 0;
-    virtual void present() = 0;
-    virtual ~Pistol() {}
-};
-
-// Concrete product of Pistol
-class ModernPistol : public Pistol
-{
-    public:
-    void shoot() override
-    { std::cout << "*pew* *pew*" << std::endl; }
-    void present() override
-    { std::cout << "This is a modern pistol." << std::endl; }
-};
-
-// Concrete product of Pistol
-class VintagePistol : public Pistol
-{
-    public:
-    void shoot() override
-    { std::cout << "*pew* (chamber moves) *pew* (chamber moves)" << std::endl; }
-    void present() override
-    { std::cout << "This is a vintage pistol." << std::endl; }
-};
-
-// Abstration of Rifle
-class Rifle
-{
-    public:
-    virtual void shoot() = 0;
-    virtual void present() = 0;
-    virtual ~Rifle() {}
-};
-
-// Concrete product of Rifle
-class ModernRifle : public Rifle
-{
-    void shoot() override
-    { std::cout << "*PEW* *PEW* *PEW* *PEW*" << std::endl; }
-    void present() override
-    { std::cout << "This a modern rifle" << std::endl; }
-};
-
-// Concrete product of Rifle
-class VintageRifle : public Rifle
-{
-    void shoot() override
-    { std::cout << "*pew* *tsch-tschink*" << std::endl; }
-    void present() override
-    { std::cout << "This is a vintage rifle" << std::endl; }
-};
-
-// Factories:
-// Abstract factory
-class FirearmFactory
+void client_code(FirearmFactory* factoryType)
 {
-    public:
-    // Create weaponry
-    virtual Pistol* createPistol() = 0;
-    virtual Rifle* createRifle() = 0;
-
-    // User weaponry
-    virtual void presentFirearm() = 0;
-
-    virtual ~FirearmFactory() {}
-};
+    std::cout << "Hmm.. Today I will create weapons" << std::endl;
+    factoryType->presentFirearm();
+    std::cout << "Nice!" << std::endl;
+}
 
-// Concrete vintage firearms factory
-class VintageFirearmFactory : public FirearmFactory
+// Same client, but the factory keeps its products in an arena and frees them all at once.
+void arena_client_code(ArenaFirearmFactory* factoryType)
 {
-    Pistol* createPistol() override
-    { return new VintagePistol; }
-    Rifle* createRifle() override
-    { return new VintageRifle; }
-
-    void presentFirearm() override
-    {
-        Pistol* concretePistol = createPistol();
-        Rifle* concreteRifle = createRifle();
-
-        concretePistol->present();
-        concretePistol->shoot();
-
-        concreteRifle->present();
-        concreteRifle->shoot();
-
-        delete concretePistol;
-        delete concreteRifle;
-    }
-};
+    std::cout << "Hmm.. Today I will create a lot of weapons" << std::endl;
+    factoryType->presentFirearm();
+    factoryType->presentFirearm();
+    factoryType->reset();
+    std::cout << "Nice, and all cleaned up at once!" << std::endl;
+}
 
-// Concrete modern firearms factory
-class ModernFirearmFactory : public FirearmFactory
+// Family known at compile time - no virtual calls and no heap.
+template<typename Family>
+void static_client_code(const StaticFirearmFactory<Family>& factoryType)
 {
-    Pistol* createPistol() override
-    { return new ModernPistol; }
-    Rifle* createRifle() override
-    { return new ModernRifle; }
-
-    void presentFirearm() override
-    {
-        Pistol* concretePistol = createPistol();
-        Rifle* concreteRifle = createRifle();
-
-        concretePistol->present();
-        concretePistol->shoot();
-
-        concreteRifle->present();
-        concreteRifle->shoot();
-
-        delete concretePistol;
-        delete concreteRifle;
-    }
-};
+    std::cout << "Hmm.. Today I will create weapons I already know" << std::endl;
+    factoryType.presentFirearm();
+    std::cout << "Nice!" << std::endl;
+}
 
-void client_code(FirearmFactory* factoryType)
+// Family chosen at runtime from a closed set.
+void variant_client_code(const AnyStaticFirearmFactory& factoryType)
 {
-    std::cout << "Hmm.. Today I will create weapons" << std::endl;
-    factoryType->presentFirearm();
+    std::cout << "Hmm.. Today I will create weapons someone else picked" << std::endl;
+    presentFirearm(factoryType);
     std::cout << "Nice!" << std::endl;
 }
 
-
 int main()
 {
     FirearmFactory* VF = new VintageFirearmFactory();
@@ -146,5 +56,12 @@ int main()
 
     delete VF;
     delete MF;
+
+    ModernArenaFirearmFactory arenaFactory;
+    arena_client_code(&arenaFactory);
+
+    static_client_code(VintageStaticFirearmFactory());
+    AnyStaticFirearmFactory pickedFactory = ModernStaticFirearmFactory();
+    variant_client_code(pickedFactory);
     return 0;
 }
@@ -0,0 +1,308 @@
+/**
+ * Classes of the Builder example, shared by the demo (main.cpp) and its benchmark (bench.cpp).
+ * The pattern itself is described in the header of main.cpp.
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ */
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+#include "SmallFlatMap.h"
+
+// Additional phone information - a phone only has a few entries, so they are kept inline
+using PhoneInfo = SmallFlatMap<std::string, std::string, 4>;
+
+// Concrete product 1 
+class Phone
+{
+    public:
+    // Essential information
+    std::string brand;
+    std::string model;
+    int ramCount;
+    int cameraPixelCount;
+    int batteryCapacity;
+    // Additional information
+    PhoneInfo additionalInfo;
+
+    // Methods
+    void showBasic()
+    {
+        std::cout << "Phone " << brand << " " << model << " with specs: " << std::endl;
+        std::cout << "RAM: " << ramCount << "GB" << std::endl;
+        std::cout << "Back camera pixel count: " << cameraPixelCount << "MP" << std::endl;
+        std::cout << "Battery cappacity: " << batteryCapacity << "mAh" << std::endl; 
+    }
+    
+    void showExtened()
+    {
+        if(additionalInfo.size() > 0)
+        {
+            std::cout << "Additional phone information: " << std::endl;
+            for(const auto& entry : additionalInfo)
+            {
+                std::cout << entry.first << ": " << entry.second << std::endl;
+            }
+        }
+    }
+
+    // Brings the phone back to a blank state, keeping the storage of its strings
+    void clear()
+    {
+        brand.clear();
+        model.clear();
+        ramCount = 0;
+        cameraPixelCount = 0;
+        batteryCapacity = 0;
+        additionalInfo.clear();
+    }
+};
+
+// Free list of phones, so a builder can hand out products without going to the heap every time.
+// Every phone is owned by the pool and deleted with it.
+class PhonePool
+{
+    private:
+    std::vector<std::unique_ptr<Phone>> owned_;
+    std::vector<Phone*> free_;
+    public:
+    Phone* acquire()
+    {
+        if(free_.empty())
+        {
+            owned_.push_back(std::make_unique<Phone>());
+            return owned_.back().get();
+        }
+        Phone* phone = free_.back();
+        free_.pop_back();
+        return phone;
+    }
+    // Gives a finished phone back for reuse
+    void release(Phone* phone)
+    {
+        phone->clear();
+        free_.push_back(phone);
+    }
+    std::size_t size() const { return owned_.size(); }
+    std::size_t available() const { return free_.size(); }
+};
+
+// Columnar description of many phones - row i of every column describes phone i.
+// Waterproof and front camera are optional, the flags say if they are set and to what.
+struct PhoneSpecTable
+{
+    enum Flags : std::uint8_t
+    {
+        HasWaterproofInfo   = 1 << 0,
+        Waterproof          = 1 << 1,
+        HasFrontCameraInfo  = 1 << 2,
+        FrontCamera         = 1 << 3
+    };
+
+    std::vector<std::string> brand;
+    std::vector<std::string> model;
+    std::vector<int> ramCount;
+    std::vector<int> cameraPixelCount;
+    std::vector<int> batteryCapacity;
+    std::vector<std::uint8_t> flags;
+
+    void addRow(std::string_view rowBrand, std::string_view rowModel, int ram, int camera, int battery, std::uint8_t rowFlags = 0)
+    {
+        brand.emplace_back(rowBrand);
+        model.emplace_back(rowModel);
+        ramCount.push_back(ram);
+        cameraPixelCount.push_back(camera);
+        batteryCapacity.push_back(battery);
+        flags.push_back(rowFlags);
+    }
+    std::size_t size() const { return brand.size(); }
+};
+
+// Built phones as a structure of arrays - one column per Phone member.
+struct PhoneCatalog
+{
+    std::vector<std::string> brand;
+    std::vector<std::string> model;
+    std::vector<int> ramCount;
+    std::vector<int> cameraPixelCount;
+    std::vector<int> batteryCapacity;
+    std::vector<PhoneInfo> additionalInfo;
+
+    void resize(std::size_t count)
+    {
+        brand.resize(count);
+        model.resize(count);
+        ramCount.resize(count);
+        cameraPixelCount.resize(count);
+        batteryCapacity.resize(count);
+        additionalInfo.resize(count);
+    }
+    // Copies the phone into the given row. Different rows can be stored from different threads.
+    void store(std::size_t row, const Phone& phone)
+    {
+        brand[row] = phone.brand;
+        model[row] = phone.model;
+        ramCount[row] = phone.ramCount;
+        cameraPixelCount[row] = phone.cameraPixelCount;
+        batteryCapacity[row] = phone.batteryCapacity;
+        additionalInfo[row] = phone.additionalInfo;
+    }
+    std::size_t size() const { return brand.size(); }
+};
+
+// Inteface builder
+class Builder
+{
+    public:
+    virtual void reset() = 0;
+    virtual void setBrand(std::string_view phoneBrand) = 0;
+    virtual void setModel(std::string_view phoneModel) = 0;
+    virtual void setRamCount(int count) = 0;
+    virtual void setBackCameraPixelCount(int count) = 0;
+    virtual void setBatteryCapacity(int capacity) = 0;
+    virtual void setWaterproof(bool isWaterproof) = 0;
+    virtual void setHasFrontCamera(bool hasCameraFront) = 0;
+    virtual ~Builder() {}
+};
+
+// Concrete builder
+// With a pool, products come from (and shall be given back to) its free list instead of new/delete.
+class PhoneBuilder : public Builder
+{
+    Phone* initPhone;
+    PhonePool* pool_;
+    public:
+    void reset() override
+    { this->initPhone = pool_ ? pool_->acquire() : new Phone; }
+    void setBrand(std::string_view phoneBrand) override
+    { this->initPhone->brand = phoneBrand; }
+    void setModel(std::string_view phoneModel) override
+    { this->initPhone->model = phoneModel; }
+    void setRamCount(int count) override
+    { this->initPhone->ramCount = count; }
+    void setBackCameraPixelCount(int count) override
+    { this->initPhone->cameraPixelCount = count; }
+    void setBatteryCapacity(int capacity) override
+    { this->initPhone->batteryCapacity = capacity; }
+    void setWaterproof(bool isWaterproof) override
+    { isWaterproof ? this->initPhone->additionalInfo.insert("Waterproof", "Yes") : this->initPhone->additionalInfo.insert("Waterproof", "No"); }
+    void setHasFrontCamera(bool hasCameraFront) override
+    { hasCameraFront ? this->initPhone->additionalInfo.insert("Camera - front ", "Yes") : this->initPhone->additionalInfo.insert("Camera -front ", "No"); }
+    Phone* getProduct()
+    {
+        Phone* productPhone = initPhone;
+        this->reset();
+        return productPhone;
+    }
+
+    PhoneBuilder(PhonePool* pool = nullptr) : initPhone(nullptr), pool_(pool) { this->reset(); }
+    ~PhoneBuilder()
+    {
+        if(!initPhone) { return; }
+        if(pool_) { pool_->release(initPhone); }
+        else { delete initPhone; }
+    }
+};
+
+class Director
+{
+    private:
+    Builder* concreteCreator;
+    public:
+    void changeBuilder(Builder* newBuilder)
+    { this->concreteCreator = newBuilder; }
+    void createMePhone()
+    {
+        this->concreteCreator->setBrand("Pear");
+        this->concreteCreator->setModel("MePhone 11");
+        this->concreteCreator->setRamCount(8);
+        this->concreteCreator->setBackCameraPixelCount(12);
+        this->concreteCreator->setBatteryCapacity(12500);
+    }
+    void createMePhonePro()
+    {
+        this->concreteCreator->setBrand("Pear");
+        this->concreteCreator->setModel("MePhone 11 Pro");
+        this->concreteCreator->setRamCount(12);
+        this->concreteCreator->setBackCameraPixelCount(16);
+        this->concreteCreator->setBatteryCapacity(12500);
+        this->concreteCreator->setWaterproof(true);
+        this->concreteCreator->setHasFrontCamera(true);
+    }
+    // Builds the phone described by one row of the table
+    void createFromSpec(const PhoneSpecTable& specs, std::size_t row)
+    {
+        this->concreteCreator->setBrand(specs.brand[row]);
+        this->concreteCreator->setModel(specs.model[row]);
+        this->concreteCreator->setRamCount(specs.ramCount[row]);
+        this->concreteCreator->setBackCameraPixelCount(specs.cameraPixelCount[row]);
+        this->concreteCreator->setBatteryCapacity(specs.batteryCapacity[row]);
+        std::uint8_t rowFlags = specs.flags[row];
+        if(rowFlags & PhoneSpecTable::HasWaterproofInfo)
+        {
+            this->concreteCreator->setWaterproof(rowFlags & PhoneSpecTable::Waterproof);
+        }
+        if(rowFlags & PhoneSpecTable::HasFrontCameraInfo)
+        {
+            this->concreteCreator->setHasFrontCamera(rowFlags & PhoneSpecTable::FrontCamera);
+        }
+    }
+
+    /// @brief Builds every phone of the table. The rows are split into one contiguous range per worker thread,
+    /// each worker drives its own Director and pooled PhoneBuilder and writes its rows of the catalog.
+    /// @param threadCount 0 uses every hardware thread.
+    /// @note The builder set with changeBuilder is not used.
+    static PhoneCatalog buildCatalog(const PhoneSpecTable& specs, unsigned int threadCount = 0)
+    {
+        PhoneCatalog catalog;
+        catalog.resize(specs.size());
+
+        if(threadCount == 0)
+        {
+            threadCount = std::max(1u, std::thread::hardware_concurrency());
+        }
+        std::size_t rowsPerWorker = (specs.size() + threadCount - 1) / threadCount;
+
+        auto buildRange = [&specs, &catalog](std::size_t first, std::size_t last)
+        {
+            PhonePool pool;
+            PhoneBuilder builder(&pool);
+            Director worker;
+            worker.changeBuilder(&builder);
+            for(std::size_t row = first; row < last; ++row)
+            {
+                worker.createFromSpec(specs, row);
+                Phone* product = builder.getProduct();
+                catalog.store(row, *product);
+                pool.release(product);
+            }
+        };
+
+        std::vector<std::thread> workers;
+        for(unsigned int i = 1; i < threadCount; ++i)
+        {
+            std::size_t first = std::min(specs.size(), i * rowsPerWorker);
+            std::size_t last = std::min(specs.size(), first + rowsPerWorker);
+            if(first < last)
+            {
+                workers.emplace_back(buildRange, first, last);
+            }
+        }
+        // The calling thread takes the first range
+        buildRange(0, std::min(specs.size(), rowsPerWorker));
+        for(std::thread& worker : workers)
+        {
+            worker.join();
+        }
+        return catalog;
+    }
+};
@@ -0,0 +1,109 @@
+/**
+ * Small sorted map kept in a flat array. The first InlineCapacity entries live inside the object itself, so a map
+ * that stays small never touches the heap (as long as its keys and values do not). Past that the entries spill
+ * into a vector. Iteration order is the key order, same as std::map.
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ */
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+template<typename Key, typename Value, std::size_t InlineCapacity>
+class SmallFlatMap
+{
+    public:
+    using value_type = std::pair<Key, Value>;
+    using iterator = value_type*;
+    using const_iterator = const value_type*;
+
+    private:
+    std::array<value_type, InlineCapacity> inline_;
+    std::vector<value_type> overflow_;
+    std::size_t size_;
+    bool spilled_;
+
+    template<typename K>
+    value_type* lowerBound(const K& key)
+    {
+        return std::lower_bound(data(), data() + size_, key, [](const value_type& entry, const K& searched) { return entry.first < searched; });
+    }
+
+    void spill()
+    {
+        overflow_.reserve(InlineCapacity * 2);
+        for(std::size_t i = 0; i < size_; ++i)
+        {
+            overflow_.push_back(std::move(inline_[i]));
+        }
+        spilled_ = true;
+    }
+
+    public:
+    SmallFlatMap() : inline_(), overflow_(), size_(0), spilled_(false) {}
+
+    // Same as std::map::insert - an existing key keeps its value. Returns true if the entry was added.
+    template<typename K, typename V>
+    bool insert(K&& key, V&& value)
+    {
+        value_type* position = lowerBound(key);
+        if(position != data() + size_ && !(key < position->first))
+        {
+            return false;
+        }
+
+        std::size_t index = position - data();
+        if(!spilled_ && size_ == InlineCapacity)
+        {
+            spill();
+        }
+        if(spilled_)
+        {
+            overflow_.emplace(overflow_.begin() + index, Key(std::forward<K>(key)), Value(std::forward<V>(value)));
+        }
+        else
+        {
+            // Shift the tail right, the slots keep their buffers so a reused map does not allocate.
+            for(std::size_t i = size_; i > index; --i)
+            {
+                std::swap(inline_[i], inline_[i - 1]);
+            }
+            inline_[index].first = std::forward<K>(key);
+            inline_[index].second = std::forward<V>(value);
+        }
+        ++size_;
+        return true;
+    }
+
+    template<typename K>
+    const Value* find(const K& key) const
+    {
+        const value_type* position = const_cast<SmallFlatMap*>(this)->lowerBound(key);
+        if(position != end() && !(key < position->first))
+        {
+            return &position->second;
+        }
+        return nullptr;
+    }
+
+    // Drops the entries but keeps the storage for reuse.
+    void clear()
+    {
+        overflow_.clear();
+        size_ = 0;
+    }
+
+    value_type* data() { return spilled_ ? overflow_.data() : inline_.data(); }
+    const value_type* data() const { return spilled_ ? overflow_.data() : inline_.data(); }
+    iterator begin() { return data(); }
+    iterator end() { return data() + size_; }
+    const_iterator begin() const { return data(); }
+    const_iterator end() const { return data() + size_; }
+    std::size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+};
@@ -0,0 +1,145 @@
+// Benchmarks of the Builder hot calls: a director driven build followed by getProduct.
+#include <benchmark/benchmark.h>
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+#include "Builder.h"
+#include "QuietOutput.h"
+
+// Counts every heap allocation made by the process, to check the pooled path does not allocate.
+// Every form of the global operators is replaced, so whatever was allocated here is also released here.
+static std::atomic<long long> allocationCount(0);
+
+static void* countedAllocate(std::size_t size, std::size_t alignment) noexcept
+{
+    allocationCount.fetch_add(1, std::memory_order_relaxed);
+    if(size == 0) { size = 1; }
+    if(alignment <= alignof(std::max_align_t)) { return std::malloc(size); }
+    // aligned_alloc wants a size that is a multiple of the alignment
+    return std::aligned_alloc(alignment, (size + alignment - 1) / alignment * alignment);
+}
+static void* countedAllocateOrThrow(std::size_t size, std::size_t alignment)
+{
+    if(void* memory = countedAllocate(size, alignment)) { return memory; }
+    throw std::bad_alloc();
+}
+static void countedRelease(void* memory) noexcept { std::free(memory); }
+
+void* operator new(std::size_t size) { return countedAllocateOrThrow(size, alignof(std::max_align_t)); }
+void* operator new[](std::size_t size) { return countedAllocateOrThrow(size, alignof(std::max_align_t)); }
+void* operator new(std::size_t size, std::align_val_t alignment) { return countedAllocateOrThrow(size, static_cast<std::size_t>(alignment)); }
+void* operator new[](std::size_t size, std::align_val_t alignment) { return countedAllocateOrThrow(size, static_cast<std::size_t>(alignment)); }
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept { return countedAllocate(size, alignof(std::max_align_t)); }
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept { return countedAllocate(size, alignof(std::max_align_t)); }
+void* operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept { return countedAllocate(size, static_cast<std::size_t>(alignment)); }
+void* operator new[](std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept { return countedAllocate(size, static_cast<std::size_t>(alignment)); }
+
+void operator delete(void* memory) noexcept { countedRelease(memory); }
+void operator delete[](void* memory) noexcept { countedRelease(memory); }
+void operator delete(void* memory, std::size_t) noexcept { countedRelease(memory); }
+void operator delete[](void* memory, std::size_t) noexcept { countedRelease(memory); }
+void operator delete(void* memory, std::align_val_t) noexcept { countedRelease(memory); }
+void operator delete[](void* memory, std::align_val_t) noexcept { countedRelease(memory); }
+void operator delete(void* memory, std::size_t, std::align_val_t) noexcept { countedRelease(memory); }
+void operator delete[](void* memory, std::size_t, std::align_val_t) noexcept { countedRelease(memory); }
+void operator delete(void* memory, const std::nothrow_t&) noexcept { countedRelease(memory); }
+void operator delete[](void* memory, const std::nothrow_t&) noexcept { countedRelease(memory); }
+void operator delete(void* memory, std::align_val_t, const std::nothrow_t&) noexcept { countedRelease(memory); }
+void operator delete[](void* memory, std::align_val_t, const std::nothrow_t&) noexcept { countedRelease(memory); }
+
+static void benchCreateMePhone(benchmark::State& state)
+{
+    PhoneBuilder builder;
+    Director director;
+    director.changeBuilder(&builder);
+    for(auto _ : state)
+    {
+        director.createMePhone();
+        Phone* product = builder.getProduct();
+        benchmark::DoNotOptimize(product);
+        delete product;
+    }
+}
+BENCHMARK(benchCreateMePhone);
+
+static void benchCreateMePhonePro(benchmark::State& state)
+{
+    PhoneBuilder builder;
+    Director director;
+    director.changeBuilder(&builder);
+    long long allocationsBefore = allocationCount.load();
+    for(auto _ : state)
+    {
+        director.createMePhonePro();
+        Phone* product = builder.getProduct();
+        benchmark::DoNotOptimize(product);
+        delete product;
+    }
+    state.counters["allocs/phone"] = benchmark::Counter(static_cast<double>(allocationCount.load() - allocationsBefore), benchmark::Counter::kAvgIterations);
+}
+BENCHMARK(benchCreateMePhonePro);
+
+// Steady state of the pooled builder - after the first phone every product is recycled.
+static void benchCreateMePhoneProPooled(benchmark::State& state)
+{
+    PhonePool pool;
+    PhoneBuilder builder(&pool);
+    Director director;
+    director.changeBuilder(&builder);
+    // Warm up the pool and the strings of its phones
+    director.createMePhonePro();
+    pool.release(builder.getProduct());
+
+    long long allocationsBefore = allocationCount.load();
+    for(auto _ : state)
+    {
+        director.createMePhonePro();
+        Phone* product = builder.getProduct();
+        benchmark::DoNotOptimize(product);
+        pool.release(product);
+    }
+    state.counters["allocs/phone"] = benchmark::Counter(static_cast<double>(allocationCount.load() - allocationsBefore), benchmark::Counter::kAvgIterations);
+}
+BENCHMARK(benchCreateMePhoneProPooled);
+
+static void benchShowPhone(benchmark::State& state)
+{
+    QuietOutput quiet;
+    PhoneBuilder builder;
+    Director director;
+    director.changeBuilder(&builder);
+    director.createMePhonePro();
+    Phone* product = builder.getProduct();
+    for(auto _ : state)
+    {
+        product->showBasic();
+        product->showExtened();
+    }
+    delete product;
+}
+BENCHMARK(benchShowPhone);
+
+// Catalog throughput - state.range(0) worker threads over a million rows mixing both MePhone variants.
+static void benchBuildCatalog(benchmark::State& state)
+{
+    const std::size_t rowCount = 1000000;
+    PhoneSpecTable specs;
+    for(std::size_t row = 0; row < rowCount; ++row)
+    {
+        if(row % 2) { specs.addRow("Pear", "MePhone 11", 8, 12, 12500); }
+        else { specs.addRow("Pear", "MePhone 11 Pro", 12, 16, 12500, PhoneSpecTable::HasWaterproofInfo | PhoneSpecTable::Waterproof | PhoneSpecTable::HasFrontCameraInfo | PhoneSpecTable::FrontCamera); }
+    }
+
+    unsigned int threadCount = static_cast<unsigned int>(state.range(0));
+    for(auto _ : state)
+    {
+        PhoneCatalog catalog = Director::buildCatalog(specs, threadCount);
+        benchmark::DoNotOptimize(catalog.ramCount.data());
+    }
+    state.SetItemsProcessed(state.iterations() * rowCount);
+    state.counters["phones/s/core"] = benchmark::Counter(static_cast<double>(state.iterations() * rowCount) / threadCount, benchmark::Counter::kIsRate);
+}
+BENCHMARK(benchBuildCatalog)->Arg(1)->Arg(2)->Arg(4)->Arg(8)->UseRealTime()->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
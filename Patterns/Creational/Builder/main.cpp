@@ -10,116 +10,7 @@
 #include <iostream>
 #include <string>
 #include <map>
-
-// Concrete product 1 
-class Phone
-{
-    public:
-    // Essential information
-    std::string brand;
-    std::string model;
-    int ramCount;
-    int cameraPixelCount;
-    int batteryCapacity;
-    // Additional information
-    std::map<std::string, std::string> additionalInfo;
-
-    // Methods
-    void showBasic()
-    {
-        std::cout << "Phone " << brand << " " << model << " with specs: " << std::endl;
-        std::cout << "RAM: " << ramCount << "GB" << std::endl;
-        std::cout << "Back camera pixel count: " << cameraPixelCount << "MP" << std::endl;
-        std::cout << "Battery cappacity: " << batteryCapacity << "mAh" << std::endl; 
-    }
-    
-    void showExtened()
-    {
-        if(additionalInfo.size() > 0)
-        {
-            std::cout << "Additional phone information: " << std::endl;
-            for(auto entry : additionalInfo)
-            {
-                std::cout << entry.first << ": " << entry.second << std::endl;
-            }
-        }
-    }
-};
-
-// Inteface builder
-class Builder
-{
-    public:
-    virtual void reset() = 0;
-    virtual void setBrand(std::string phoneBrand) = 0;
-    virtual void setModel(std::string phoneModel) = 0;
-    virtual void setRamCount(int count) = 0;
-    virtual void setBackCameraPixelCount(int count) = 0;
-    virtual void setBatteryCapacity(int capacity) = 0;
-    virtual void setWaterproof(bool isWaterproof) = 0;
-    virtual void setHasFrontCamera(bool hasCameraFront) = 0;
-    virtual ~Builder() {}
-};
-
-// Concrete builder
-class PhoneBuilder : public Builder
-{
-    Phone* initPhone;
-    public:
-    void reset() override
-    { this->initPhone = new Phone; }
-    void setBrand(std::string phoneBrand) override
-    { this->initPhone->brand = phoneBrand; }
-    void setModel(std::string phoneModel) override
-    { this->initPhone->model = phoneModel; }
-    void setRamCount(int count) override
-    { this->initPhone->ramCount = count; }
-    void setBackCameraPixelCount(int count) override
-    { this->initPhone->cameraPixelCount = count; }
-    void setBatteryCapacity(int capacity) override
-    { this->initPhone->batteryCapacity = capacity; }
-    void setWaterproof(bool isWaterproof) override
-    { isWaterproof ? this->initPhone->additionalInfo.insert(std::make_pair("Waterproof", "Yes")) : this->initPhone->additionalInfo.insert(std::make_pair("Waterproof", "No")); }
-    void setHasFrontCamera(bool hasCameraFront) override
-    { hasCameraFront ? this->initPhone->additionalInfo.insert(std::make_pair("Camera - front ", "Yes")) : this->initPhone->additionalInfo.insert(std::make_pair("Camera -front ", "No")); }
-    Phone* getProduct()
-    {
-        Phone* productPhone = initPhone;
-        this->reset();
-        return productPhone;
-    }
-
-    PhoneBuilder() { this->reset(); }
-    ~PhoneBuilder()
-    { if(initPhone) { delete initPhone; } }
-};
-
-class Director
-{
-    private:
-    Builder* concreteCreator;
-    public:
-    void changeBuilder(Builder* newBuilder)
-    { this->concreteCreator = newBuilder; }
-    void createMePhone()
-    {
-        this->concreteCreator->setBrand("Pear");
-        this->concreteCreator->setModel("MePhone 11");
-        this->concreteCreator->setRamCount(8);
-        this->concreteCreator->setBackCameraPixelCount(12);
-        this->concreteCreator->setBatteryCapacity(12500);
-    }
-    void createMePhonePro()
-    {
-        this->concreteCreator->setBrand("Pear");
-        this->concreteCreator->setModel("MePhone 11 Pro");
-        this->concreteCreator->setRamCount(12);
-        this->concreteCreator->setBackCameraPixelCount(16);
-        this->concreteCreator->setBatteryCapacity(12500);
-        this->concreteCreator->setWaterproof(true);
-        this->concreteCreator->setHasFrontCamera(true);
-    }
-};
+#include "Builder.h"
 
 void clientCode(Director* director)
 {
@@ -167,10 +58,49 @@ void clientCode(Director* director)
     delete phoneSpammingMachine;
 }
 
+// Same director, but the phones are recycled through a pool instead of being deleted.
+void pooledClientCode(Director* director)
+{
+    PhonePool phoneStock;
+    PhoneBuilder* phoneRecyclingMachine = new PhoneBuilder(&phoneStock);
+    director->changeBuilder(phoneRecyclingMachine);
+
+    for(int i = 0; i < 2; i++)
+    {
+        director->createMePhonePro();
+        Phone* mePhonePro = phoneRecyclingMachine->getProduct();
+        mePhonePro->showBasic();
+        mePhonePro->showExtened();
+        // Return the phone, the next one reuses it
+        phoneStock.release(mePhonePro);
+    }
+
+    std::cout << "Phones ever allocated by the pool: " << phoneStock.size() << std::endl;
+    delete phoneRecyclingMachine;
+}
+
+// Whole catalog at once - specs go in as columns, phones come out as columns.
+void catalogClientCode()
+{
+    PhoneSpecTable specs;
+    specs.addRow("Pear", "MePhone 11", 8, 12, 12500);
+    specs.addRow("Pear", "MePhone 11 Pro", 12, 16, 12500, PhoneSpecTable::HasWaterproofInfo | PhoneSpecTable::Waterproof | PhoneSpecTable::HasFrontCameraInfo | PhoneSpecTable::FrontCamera);
+    specs.addRow("Pear", "MePhone 12", 10, 14, 10250);
+
+    PhoneCatalog catalog = Director::buildCatalog(specs, 2);
+    std::cout << "Catalog of " << catalog.size() << " phones:" << std::endl;
+    for(size_t i = 0; i < catalog.size(); i++)
+    {
+        std::cout << catalog.brand[i] << " " << catalog.model[i] << " - " << catalog.ramCount[i] << "GB RAM, " << catalog.additionalInfo[i].size() << " additional entries" << std::endl;
+    }
+}
+
 int main(int argc, char const *argv[])
 {
     Director* concreteCreator = new Director;
     clientCode(concreteCreator);
+    pooledClientCode(concreteCreator);
+    catalogClientCode();
     delete concreteCreator;
     return 0;
 }
@@ -0,0 +1,176 @@
+/**
+ * Classes of the Factory method example, shared by the demo (main.cpp) and its benchmark (bench.cpp).
+ * The pattern itself is described in the header of main.cpp.
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ */
+#pragma once
+
+#include <iostream>
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <vector>
+#include "MovementScheduler.h"
+
+// Moving interface
+class MoveVechicle
+{
+    public:
+    virtual void move() = 0;
+    virtual ~MoveVechicle() {}
+};
+
+// The following classes are the products
+// Superclass
+class Vechicle : public MoveVechicle
+{
+    public:
+    virtual void showDetails() = 0;
+    virtual void move() {}
+    /// @brief Non blocking move - phases that have to wait are resumed later by the scheduler.
+    /// @note The vechicle has to stay alive until the scheduler has nothing pending.
+    virtual void moveAsync(MovementScheduler&) { move(); }
+    virtual ~Vechicle() {}
+};
+
+// Child class
+class Car final : public Vechicle
+{
+    public:
+    void showDetails() override 
+    { std::cout << "This is a car!\n"; }
+    void move() override
+    { std::cout << "Pressing the gas pedal, and gooooo!" << std::endl; }
+};
+
+// Another Child class
+class Plane final : public Vechicle
+{
+    public:
+    void showDetails() override
+    { std::cout << "This is a plane!\n"; }
+    // Blocking move - drives its own scheduler until the plane is in the air.
+    void move() override
+    {
+        MovementScheduler scheduler;
+        moveAsync(scheduler);
+        scheduler.run();
+    }
+    void moveAsync(MovementScheduler& scheduler) override
+    {
+        std::cout << "Prepare for lift of!" << std::endl;
+        scheduler.schedule(std::chrono::seconds(1), [&scheduler]()
+        {
+            std::cout << "Lifting!" << std::endl;
+            scheduler.schedule(std::chrono::seconds(1), []() { std::cout << "On air, and moving." << std::endl; });
+        });
+    }
+};
+
+// Batch of vechicles stored by value and segregated by type - every car next to each other, every plane next to each other.
+// Since Car and Plane are final, calls made on the stored objects are resolved without the virtual dispatch.
+class VechicleBatch
+{
+    private:
+    std::vector<Car> cars_;
+    std::vector<Plane> planes_;
+    public:
+    void addCars(std::size_t count) { cars_.resize(cars_.size() + count); }
+    void addPlanes(std::size_t count) { planes_.resize(planes_.size() + count); }
+    void reserve(std::size_t carCount, std::size_t planeCount)
+    {
+        cars_.reserve(carCount);
+        planes_.reserve(planeCount);
+    }
+
+    // Calls func on every vechicle, one type segment after the other.
+    template<typename Func>
+    void forEach(Func func)
+    {
+        for(Car& car : cars_) { func(car); }
+        for(Plane& plane : planes_) { func(plane); }
+    }
+    // Starts every vechicle on the scheduler, the planes take off together once it is driven.
+    void moveAll(MovementScheduler& scheduler) { forEach([&scheduler](auto& vechicle) { vechicle.moveAsync(scheduler); }); }
+    // Blocking - returns once every vechicle has arrived, which for any number of planes is a single take off.
+    void moveAll()
+    {
+        MovementScheduler scheduler;
+        moveAll(scheduler);
+        scheduler.run();
+    }
+
+    std::vector<Car>& cars() { return cars_; }
+    std::vector<Plane>& planes() { return planes_; }
+    std::size_t size() const { return cars_.size() + planes_.size(); }
+    void clear()
+    {
+        cars_.clear();
+        planes_.clear();
+    }
+};
+
+// Factory part
+class Creator
+{
+    public:
+    virtual ~Creator() {} 
+    virtual Vechicle* createVechicle() = 0;
+    // Appends count vechicles of this factory's type into the batch.
+    virtual void appendBatch(VechicleBatch& batch, std::size_t count) = 0;
+
+    VechicleBatch createBatch(std::size_t count)
+    {
+        VechicleBatch batch;
+        this->appendBatch(batch, count);
+        return batch;
+    }
+
+    void presentVechicle()
+    { 
+        Vechicle* createdVechicle = this->createVechicle();
+        createdVechicle->showDetails();
+
+        delete createdVechicle;
+    }
+    // Blocking - returns once the vechicle has arrived.
+    void changeLocation()
+    {
+        MovementScheduler scheduler;
+        std::unique_ptr<Vechicle> createdVechicle = this->changeLocation(scheduler);
+        scheduler.run();
+    }
+    /// @brief Non blocking - the phases that have to wait are left on the caller's scheduler.
+    /// @return The moving vechicle, it has to be kept until the scheduler has nothing pending.
+    std::unique_ptr<Vechicle> changeLocation(MovementScheduler& scheduler)
+    {
+        // One vechicle is enough to both present it and move it.
+        std::unique_ptr<Vechicle> createdVechicle(this->createVechicle());
+        createdVechicle->showDetails();
+        createdVechicle->moveAsync(scheduler);
+        return createdVechicle;
+    }
+
+};
+
+// Concrete Factory (Creator) of Cars
+class CarFactory : public Creator
+{
+    public:
+    Vechicle* createVechicle() override
+    { return new Car; }
+    void appendBatch(VechicleBatch& batch, std::size_t count) override
+    { batch.addCars(count); }
+};
+
+// Concrete Factory (Creator) of Planes
+class PlaneFactory : public Creator
+{
+    public:
+    Vechicle* createVechicle() override
+    { return new Plane; }
+    void appendBatch(VechicleBatch& batch, std::size_t count) override
+    { batch.addPlanes(count); }
+};
@@ -0,0 +1,106 @@
+/**
+ * Single threaded scheduler for delayed movement phases, built as a hashed timer wheel. Instead of blocking while a
+ * vechicle waits for its next phase, the phase is registered on the wheel and resumed once its tick comes.
+ * Any number of vechicles can progress at the same time on the thread that drives the scheduler.
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ */
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <thread>
+#include <utility>
+#include <vector>
+
+class MovementScheduler
+{
+    public:
+    using Clock = std::chrono::steady_clock;
+    using Task = std::function<void()>;
+
+    private:
+    struct Timer
+    {
+        std::uint64_t dueTick;
+        Task task;
+    };
+    std::chrono::milliseconds tickLength_;
+    std::vector<std::vector<Timer>> slots_;
+    std::vector<Timer> expired_;
+    std::uint64_t currentTick_;
+    std::size_t pending_;
+
+    public:
+    explicit MovementScheduler(std::chrono::milliseconds tickLength = std::chrono::milliseconds(10), std::size_t slotCount = 512) :
+    tickLength_(tickLength), slots_(slotCount), expired_(), currentTick_(0), pending_(0) {}
+
+    // Runs task once delay has passed. The delay is rounded up to whole ticks, and is at least one tick - a negative
+    // delay counts as none.
+    void schedule(std::chrono::milliseconds delay, Task task)
+    {
+        std::chrono::milliseconds::rep count = delay.count() < 0 ? 0 : delay.count();
+        std::uint64_t ticks = static_cast<std::uint64_t>((count + tickLength_.count() - 1) / tickLength_.count());
+        std::uint64_t dueTick = currentTick_ + (ticks == 0 ? 1 : ticks);
+        slots_[dueTick % slots_.size()].push_back(Timer{dueTick, std::move(task)});
+        ++pending_;
+    }
+
+    // Moves the wheel by the given number of ticks without waiting, running every task that became due.
+    // Returns the number of tasks that were run.
+    std::size_t advance(std::size_t ticks = 1)
+    {
+        std::size_t ran = 0;
+        for(std::size_t step = 0; step < ticks; ++step)
+        {
+            ++currentTick_;
+            std::vector<Timer>& slot = slots_[currentTick_ % slots_.size()];
+            // Timers from later rounds of the wheel stay in the slot, the due ones are run after the split,
+            // so a task is free to schedule new timers - even into this very slot.
+            expired_.clear();
+            std::size_t kept = 0;
+            for(std::size_t i = 0; i < slot.size(); ++i)
+            {
+                if(slot[i].dueTick == currentTick_) { expired_.push_back(std::move(slot[i])); }
+                else { slot[kept++] = std::move(slot[i]); }
+            }
+            slot.resize(kept);
+            pending_ -= expired_.size();
+            for(Timer& timer : expired_)
+            {
+                timer.task();
+            }
+            ran += expired_.size();
+        }
+        return ran;
+    }
+
+    // Advances without waiting until nothing is left - simulated time, used to measure the scheduling cost itself.
+    std::size_t advanceUntilIdle()
+    {
+        std::size_t ran = 0;
+        while(pending_ > 0)
+        {
+            ran += advance();
+        }
+        return ran;
+    }
+
+    // Advances in real time until nothing is left, sleeping between the ticks.
+    void run()
+    {
+        Clock::time_point nextTick = Clock::now();
+        while(pending_ > 0)
+        {
+            nextTick += tickLength_;
+            std::this_thread::sleep_until(nextTick);
+            advance();
+        }
+    }
+
+    std::size_t pending() const { return pending_; }
+    std::chrono::milliseconds tickLength() const { return tickLength_; }
+};
@@ -0,0 +1,130 @@
+// Benchmarks of the Factory method hot calls.
+// A plane's take off waits two seconds of real time, so the planes are only timed on a scheduler advanced in simulated
+// time (benchPlaneChangeLocationAsync, benchConcurrentPlaneMoves).
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <vector>
+#include "FactoryMethod.h"
+#include "QuietOutput.h"
+
+static void benchCreateVechicle(benchmark::State& state)
+{
+    std::unique_ptr<Creator> factory(new CarFactory);
+    for(auto _ : state)
+    {
+        Vechicle* product = factory->createVechicle();
+        benchmark::DoNotOptimize(product);
+        delete product;
+    }
+}
+BENCHMARK(benchCreateVechicle);
+
+static void benchPresentVechicle(benchmark::State& state)
+{
+    QuietOutput quiet;
+    std::unique_ptr<Creator> factory(new PlaneFactory);
+    for(auto _ : state)
+    {
+        factory->presentVechicle();
+    }
+}
+BENCHMARK(benchPresentVechicle);
+
+static void benchCarChangeLocation(benchmark::State& state)
+{
+    QuietOutput quiet;
+    std::unique_ptr<Creator> factory(new CarFactory);
+    for(auto _ : state)
+    {
+        factory->changeLocation();
+    }
+}
+BENCHMARK(benchCarChangeLocation);
+
+// The plane's take off left on a scheduler, which is then driven in simulated time.
+static void benchPlaneChangeLocationAsync(benchmark::State& state)
+{
+    QuietOutput quiet;
+    std::unique_ptr<Creator> factory(new PlaneFactory);
+    MovementScheduler scheduler;
+    for(auto _ : state)
+    {
+        std::unique_ptr<Vechicle> plane = factory->changeLocation(scheduler);
+        scheduler.advanceUntilIdle();
+    }
+}
+BENCHMARK(benchPlaneChangeLocationAsync);
+
+// Sweep of state.range(0) cars: created and moved one at a time, as changeLocation does.
+static void benchSweepOneAtATime(benchmark::State& state)
+{
+    QuietOutput quiet;
+    std::unique_ptr<Creator> factory(new CarFactory);
+    for(auto _ : state)
+    {
+        for(int64_t i = 0; i < state.range(0); ++i)
+        {
+            Vechicle* vechicle = factory->createVechicle();
+            vechicle->move();
+            delete vechicle;
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(benchSweepOneAtATime)->Arg(10000000)->Unit(benchmark::kMillisecond);
+
+// The same cars kept as scattered heap objects and moved through the interface.
+static void benchSweepScattered(benchmark::State& state)
+{
+    QuietOutput quiet;
+    std::unique_ptr<Creator> factory(new CarFactory);
+    std::vector<Vechicle*> fleet;
+    for(int64_t i = 0; i < state.range(0); ++i)
+    {
+        fleet.push_back(factory->createVechicle());
+    }
+    for(auto _ : state)
+    {
+        for(auto vechicle : fleet)
+        {
+            vechicle->move();
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    for(auto vechicle : fleet) { delete vechicle; }
+}
+BENCHMARK(benchSweepScattered)->Arg(10000000)->Unit(benchmark::kMillisecond);
+
+// The same cars in one contiguous batch.
+static void benchSweepBatch(benchmark::State& state)
+{
+    QuietOutput quiet;
+    std::unique_ptr<Creator> factory(new CarFactory);
+    VechicleBatch fleet = factory->createBatch(static_cast<std::size_t>(state.range(0)));
+    for(auto _ : state)
+    {
+        fleet.moveAll();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(benchSweepBatch)->Arg(10000000)->Unit(benchmark::kMillisecond);
+
+// How many plane take offs one core can keep in flight: state.range(0) planes start together and the scheduler is
+// advanced in simulated time, so only the scheduling and the phase work are measured, not the waiting.
+static void benchConcurrentPlaneMoves(benchmark::State& state)
+{
+    QuietOutput quiet;
+    std::unique_ptr<Creator> factory(new PlaneFactory);
+    VechicleBatch fleet = factory->createBatch(static_cast<std::size_t>(state.range(0)));
+    MovementScheduler scheduler;
+    for(auto _ : state)
+    {
+        fleet.moveAll(scheduler);
+        benchmark::DoNotOptimize(scheduler.advanceUntilIdle());
+    }
+    // Items are whole take off sequences
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(benchConcurrentPlaneMoves)->Arg(1000)->Arg(100000)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
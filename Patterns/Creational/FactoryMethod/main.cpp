@@ -10,98 +10,28 @@
  */
 #include <iostream>
 #include <cstdlib>
-
-// Moving interface
-class MoveVechicle
-{
-    public:
-    virtual void move() = 0;
-    virtual ~MoveVechicle() {}
-};
-
-// The following classes are the products
-// Superclass
-class Vechicle : public MoveVechicle
-{
-    public:
-    virtual void showDetails() = 0;
-    virtual void move() {}
-    virtual ~Vechicle() {}
-};
-
-// Child class
-class Car : public Vechicle
-{
-    public:
-    void showDetails() override 
-    { std::cout << "This is a car!\n"; }
-    void move() override
-    { std::cout << "Pressing the gas pedal, and gooooo!" << std::endl; }
-};
-
-// Another Child class
-class Plane : public Vechicle
-{
-    public:
-    void showDetails() override
-    { std::cout << "This is a plane!\n"; }
-    void move() override
-    {
-        std::cout << "Prepare for lift of!" << std::endl;
-        system("sleep 1");
-        std::cout << "Lifting!" << std::endl;
-        system("sleep 1");
-        std::cout << "On air, and moving." << std::endl;
-    }
-};
-
-// Factory part
-class Creator
-{
-    public:
-    virtual ~Creator() {} 
-    virtual Vechicle* createVechicle() = 0;
-
-    void presentVechicle()
-    { 
-        Vechicle* createdVechicle = this->createVechicle();
-        createdVechicle->showDetails();
-
-        delete createdVechicle;
-    }
-    void changeLocation()
-    {
-        presentVechicle();
-        Vechicle* createdVechicle = this->createVechicle();
-        createdVechicle->move();
-
-        delete createdVechicle;
-    }
-
-};
-
-// Concrete Factory (Creator) of Cars
-class CarFactory : public Creator
-{
-    public:
-    Vechicle* createVechicle() override
-    { return new Car; }
-};
-
-// Concrete Factory (Creator) of Planes
-class PlaneFactory : public Creator
-{
-    public:
-    Vechicle* createVechicle() override
-    { return new Plane; }
-};
+#include <memory>
+#include "FactoryMethod.h"
 
 int main()
 {
     Creator* VCF = new CarFactory;
     VCF->changeLocation();
     Creator* VPF = new PlaneFactory;
-    VPF->changeLocation();
+    // The plane waits for its take off on a scheduler, the caller decides when to drive it
+    MovementScheduler airTraffic;
+    std::unique_ptr<Vechicle> plane = VPF->changeLocation(airTraffic);
+    airTraffic.run();
+
+    // Create a whole fleet at once and move it in one go
+    VechicleBatch fleet = VCF->createBatch(3);
+    fleet.forEach([](Vechicle& vechicle) { vechicle.showDetails(); });
+    fleet.moveAll();
+
+    // Planes take off together - one scheduler resumes every plane, so three take offs still last two seconds
+    VechicleBatch airFleet = VPF->createBatch(3);
+    airFleet.moveAll(airTraffic);
+    airTraffic.run();
 
     delete VCF;
     delete VPF;
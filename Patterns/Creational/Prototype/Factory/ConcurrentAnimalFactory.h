@@ -0,0 +1,135 @@
+/**
+ * Animal factory meant to be shared by many threads. The presets are registered before the factory is handed to the
+ * other threads and are never changed afterwards, so cloning reads them without any lock.
+ * The memory of the clones is recycled per thread: a destroyed clone goes to a free list of the thread that destroys
+ * it, and the next clone of that size on the thread takes it from there, without touching the global allocator.
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include "PrototypeFactory.h"
+
+// Free blocks of one thread, kept per size class of Granularity bytes.
+class AnimalFreeList
+{
+    public:
+    static constexpr std::size_t Granularity = 16;
+    static constexpr std::size_t ClassCount = 16;       // Bigger objects bypass the free list
+    static constexpr std::size_t MaxCached = 4096;      // Per class - a thread that only destroys does not hoard memory
+
+    private:
+    struct Block
+    {
+        Block* next;
+    };
+    std::array<Block*, ClassCount> heads_;
+    std::array<std::size_t, ClassCount> counts_;
+
+    static std::size_t sizeClass(std::size_t size) { return (size + Granularity - 1) / Granularity - 1; }
+
+    AnimalFreeList() : heads_(), counts_() {}
+
+    public:
+    AnimalFreeList(const AnimalFreeList&) = delete;
+    AnimalFreeList& operator=(const AnimalFreeList&) = delete;
+    ~AnimalFreeList()
+    {
+        for(Block* head : heads_)
+        {
+            while(head)
+            {
+                Block* next = head->next;
+                ::operator delete(head);
+                head = next;
+            }
+        }
+    }
+
+    // Free list of the calling thread
+    static AnimalFreeList& local()
+    {
+        thread_local AnimalFreeList freeList;
+        return freeList;
+    }
+
+    void* allocate(std::size_t size)
+    {
+        std::size_t index = sizeClass(size);
+        if(index >= ClassCount) { return ::operator new(size); }
+        if(Block* block = heads_[index])
+        {
+            heads_[index] = block->next;
+            --counts_[index];
+            return block;
+        }
+        return ::operator new((index + 1) * Granularity);
+    }
+
+    void recycle(void* memory, std::size_t size)
+    {
+        std::size_t index = sizeClass(size);
+        if(index >= ClassCount || counts_[index] == MaxCached)
+        {
+            ::operator delete(memory);
+            return;
+        }
+        heads_[index] = new (memory) Block{heads_[index]};
+        ++counts_[index];
+    }
+};
+
+// Deleter of the clones - destroys the animal and gives its memory to the free list of the calling thread.
+struct RecycleAnimal
+{
+    void operator()(Animal* animal) const
+    {
+        std::size_t size = animal->cloneSize();
+        void* memory = dynamic_cast<void*>(animal);   // Start of the whole object, where cloneAt put it
+        animal->~Animal();
+        AnimalFreeList::local().recycle(memory, size);
+    }
+};
+
+using AnimalHandle = std::unique_ptr<Animal, RecycleAnimal>;
+
+class ConcurrentAnimalFactory
+{
+    private:
+    AnimalFactory presets_;
+
+    public:
+    ConcurrentAnimalFactory() : presets_() {}
+
+    /// @brief Adds a new preset (or replaces an existing one), the factory takes ownership of the prototype.
+    /// @note Only while no other thread uses the factory - starting the threads afterwards publishes the presets.
+    void registerPrototype(LivestockType animalType, LivestockColor animalColor, Animal* prototype)
+    {
+        presets_.registerPrototype(animalType, animalColor, prototype);
+    }
+
+    // Factory method, safe to call from any number of threads.
+    /// @return Empty handle if no prototype is registered for the pair.
+    AnimalHandle CreateAnimal(LivestockType animalType, LivestockColor animalColor) const
+    {
+        const Animal* prototype = presets_.findPrototype(animalType, animalColor);
+        if(!prototype) { return AnimalHandle(); }
+
+        std::size_t size = prototype->cloneSize();
+        void* memory = AnimalFreeList::local().allocate(size);
+        try
+        {
+            return AnimalHandle(prototype->cloneAt(memory));
+        }
+        catch(...)
+        {
+            AnimalFreeList::local().recycle(memory, size);
+            throw;
+        }
+    }
+};
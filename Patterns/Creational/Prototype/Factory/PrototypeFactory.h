@@ -0,0 +1,187 @@
+/**
+ * Classes of the Prototype factory example, shared by the demo (main.cpp) and its benchmark (bench.cpp).
+ * The pattern itself is described in the header of main.cpp.
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <utility>
+#include <iostream>
+#include <new>
+#include <string>
+#include <vector>
+#include "PrototypeRegistry.h"
+#include "PrototypeSnapshot.h"
+
+enum LivestockType
+{
+    LTCow = 0,
+    LTSheep,
+    LTCount   // Number of the types above, other values can only be registered at runtime
+};
+
+// Consider using the preset colors
+enum LivestockColor
+{
+    LCBlack = 0,
+    LCBrown,
+    LCWhite,
+    LCCount   // Number of the colors above, other values can only be registered at runtime
+};
+
+// Prototype interface
+class Animal
+{
+    protected:
+    /// @note this is a name of the spiecies not individual animal per se.
+    std::string animalName_;
+    public:
+
+    // Constructor
+    Animal() {}
+    Animal(std::string name) : animalName_(name) {}
+
+    // Cloning
+    virtual Animal* clone() const = 0;
+    // Clones into storage of at least cloneSize() bytes, for factories that manage the memory of their clones.
+    virtual Animal* cloneAt(void* storage) const = 0;
+    virtual std::size_t cloneSize() const = 0;
+    // What a snapshot keeps of the prototype - its kind and the color it is created with.
+    virtual LivestockType kind() const = 0;
+    virtual const std::string& color() const = 0;
+    virtual void show() const = 0;
+    virtual ~Animal() {}
+};
+
+// Concrete prototype 1
+class Cow : public Animal
+{
+    private:
+    // Additional attributes related to the concrete prototype
+    std::string patchesColor_;
+    public:
+    // Creation
+    Cow(std::string patchesColor) : Animal("Cow"), patchesColor_(patchesColor) {}
+    // Cloning
+    Animal* clone() const override
+    { return new Cow(*this); }
+    Animal* cloneAt(void* storage) const override
+    { return new (storage) Cow(*this); }
+    std::size_t cloneSize() const override { return sizeof(Cow); }
+    LivestockType kind() const override { return LTCow; }
+    const std::string& color() const override { return patchesColor_; }
+    // Additional methods  
+    void show() const override 
+    { std::cout << "This is a " << animalName_ << " with " << patchesColor_ << " patches" << std::endl; }
+};
+
+// Concrete prototype 2
+class Sheep : public Animal
+{
+    private:
+    std::string woolColor_;
+    public:
+    Sheep(std::string woolColor) : Animal("Sheep"), woolColor_(woolColor) {}
+    Animal* clone() const override
+    { return new Sheep(*this); }
+    Animal* cloneAt(void* storage) const override
+    { return new (storage) Sheep(*this); }
+    std::size_t cloneSize() const override { return sizeof(Sheep); }
+    LivestockType kind() const override { return LTSheep; }
+    const std::string& color() const override { return woolColor_; }
+    void show() const override
+    { std::cout << "This is a " << woolColor_ << " " << animalName_ << std::endl; }
+};
+
+// Prototype of the given kind, nullptr for an unknown kind.
+inline Animal* makeAnimal(LivestockType kind, std::string color)
+{
+    switch(kind)
+    {
+        case LTCow: return new Cow(color);
+        case LTSheep: return new Sheep(color);
+        default: return nullptr;
+    }
+}
+
+class AnimalFactory
+{
+    private:
+    PrototypeRegistry<Animal, LivestockType, LivestockColor, LTCount, LCCount> livestockPreset_;
+    PrototypeSnapshot snapshot_;
+
+    // Rebuilds a preset from the snapshot, once - from then on it is served by the registry.
+    Animal* restorePrototype(LivestockType animalType, LivestockColor animalColor)
+    {
+        std::optional<SnapshotEntry> entry = snapshot_.find(animalType, animalColor);
+        if(!entry) { return nullptr; }
+        Animal* prototype = makeAnimal(static_cast<LivestockType>(entry->kind), std::string(entry->text));
+        livestockPreset_.add(animalType, animalColor, prototype);
+        return prototype;
+    }
+
+    public:
+    // Constructor
+    AnimalFactory() : livestockPreset_(), snapshot_()
+    {
+        // Handle cows
+        livestockPreset_.add(LivestockType::LTCow, LCBlack, new Cow("Black"));
+        livestockPreset_.add(LivestockType::LTCow, LCBrown, new Cow("Brown"));
+        livestockPreset_.add(LivestockType::LTCow, LCWhite, new Cow("White"));
+
+        // Handle sheeps
+        livestockPreset_.add(LivestockType::LTSheep, LCBlack, new Sheep("Black"));
+        livestockPreset_.add(LivestockType::LTSheep, LCBrown, new Sheep("Brown"));
+        livestockPreset_.add(LivestockType::LTSheep, LCWhite, new Sheep("White"));
+    }
+
+    // Factory method
+    /// @return nullptr if no prototype is registered for the pair.
+    Animal* CreateAnimal(LivestockType animalType, LivestockColor animalColor)
+    {
+        Animal* prototype = livestockPreset_.find(animalType, animalColor);
+        if(!prototype && !snapshot_.empty())
+        {
+            prototype = restorePrototype(animalType, animalColor);
+        }
+        return prototype ? prototype->clone() : nullptr;
+    }
+
+    // The preset itself, nullptr if none is registered for the pair.
+    /// @note Presets of a snapshot show up here only after their first CreateAnimal.
+    const Animal* findPrototype(LivestockType animalType, LivestockColor animalColor) const
+    {
+        return livestockPreset_.find(animalType, animalColor);
+    }
+
+    // Adds a new preset (or replaces an existing one), the factory takes ownership of the prototype.
+    void registerPrototype(LivestockType animalType, LivestockColor animalColor, Animal* prototype)
+    {
+        livestockPreset_.add(animalType, animalColor, prototype);
+    }
+
+    // Factory with the presets of a snapshot written by saveSnapshot. The file is only mapped here,
+    // every preset is rebuilt on the first CreateAnimal that asks for it. A file that can not be read gives no presets.
+    explicit AnimalFactory(const std::string& snapshotPath) : livestockPreset_(), snapshot_(snapshotPath) {}
+
+    // Writes every preset, including the ones of a loaded snapshot that were not rebuilt yet.
+    bool saveSnapshot(const std::string& path) const
+    {
+        std::vector<SnapshotEntry> entries;
+        entries.reserve(livestockPreset_.size() + snapshot_.size());
+        livestockPreset_.forEach([&entries](LivestockType animalType, LivestockColor animalColor, const Animal* prototype)
+        {
+            entries.push_back(SnapshotEntry{animalType, animalColor, static_cast<std::uint32_t>(prototype->kind()), prototype->color()});
+        });
+        // Registered presets come first, so they win over the snapshot entries of the same key.
+        snapshot_.forEach([&entries](const SnapshotEntry& entry) { entries.push_back(entry); });
+        return PrototypeSnapshot::write(path, std::move(entries));
+    }
+
+    std::size_t snapshotSize() const { return snapshot_.size(); }
+};
@@ -0,0 +1,153 @@
+/**
+ * Registry of the prototypes held by the AnimalFactory. Every type/color pair known at compile time has its own slot in a flat array, so a lookup is one bounds check and one index. Prototypes registered at runtime
+ * under any other pair go into an open addressing (linear probing) overflow table.
+ * The registry owns its prototypes.
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Prototypes are keyed by a pair of enums, the values below TypeCount/ColorCount are the ones known at compile time.
+template<typename Prototype, typename Type, typename Color, std::size_t TypeCount, std::size_t ColorCount>
+class PrototypeRegistry
+{
+    private:
+    struct Slot
+    {
+        std::uint64_t key;
+        Prototype* prototype;   // nullptr marks an empty slot
+    };
+    std::array<Prototype*, TypeCount * ColorCount> dense_;
+    std::vector<Slot> overflow_;
+    std::size_t overflowSize_;
+
+    static bool isDense(Type type, Color color)
+    {
+        return static_cast<std::size_t>(type) < TypeCount && static_cast<std::size_t>(color) < ColorCount;
+    }
+    static std::size_t denseIndex(Type type, Color color)
+    {
+        return static_cast<std::size_t>(type) * ColorCount + static_cast<std::size_t>(color);
+    }
+    static std::uint64_t overflowKey(Type type, Color color)
+    {
+        return static_cast<std::uint64_t>(static_cast<std::uint32_t>(type)) << 32 | static_cast<std::uint32_t>(color);
+    }
+    // Fibonacci hashing, the table size is a power of two.
+    std::size_t overflowHome(std::uint64_t key) const
+    {
+        return static_cast<std::size_t>((key * 0x9E3779B97F4A7C15ull) >> 32) & (overflow_.size() - 1);
+    }
+
+    Slot* findSlot(std::uint64_t key)
+    {
+        if(overflow_.empty()) { return nullptr; }
+        for(std::size_t i = overflowHome(key);; i = (i + 1) & (overflow_.size() - 1))
+        {
+            if(overflow_[i].prototype == nullptr) { return &overflow_[i]; }
+            if(overflow_[i].key == key) { return &overflow_[i]; }
+        }
+    }
+
+    // Keeps the table at most half full, so a probe sequence stays short and always ends on an empty slot.
+    void growOverflow()
+    {
+        std::vector<Slot> old(overflow_.empty() ? 16 : overflow_.size() * 2, Slot{0, nullptr});
+        old.swap(overflow_);
+        for(const Slot& slot : old)
+        {
+            if(slot.prototype) { *findSlot(slot.key) = slot; }
+        }
+    }
+
+    public:
+    PrototypeRegistry() : dense_(), overflow_(), overflowSize_(0) {}
+    PrototypeRegistry(const PrototypeRegistry&) = delete;
+    PrototypeRegistry& operator=(const PrototypeRegistry&) = delete;
+    ~PrototypeRegistry() { clear(); }
+
+    // Prototype registered for the pair, nullptr if there is none.
+    Prototype* find(Type type, Color color) const
+    {
+        if(isDense(type, color))
+        {
+            return dense_[denseIndex(type, color)];
+        }
+        Slot* slot = const_cast<PrototypeRegistry*>(this)->findSlot(overflowKey(type, color));
+        return slot ? slot->prototype : nullptr;
+    }
+
+    // Takes ownership of the prototype, a prototype registered before for the same pair is deleted. Adding the prototype
+    // already registered for the pair changes nothing.
+    void add(Type type, Color color, Prototype* prototype)
+    {
+        if(prototype == nullptr) { return; }
+        if(isDense(type, color))
+        {
+            Prototype*& entry = dense_[denseIndex(type, color)];
+            if(entry == prototype) { return; }
+            delete entry;
+            entry = prototype;
+            return;
+        }
+        if((overflowSize_ + 1) * 2 > overflow_.size())
+        {
+            growOverflow();
+        }
+        std::uint64_t key = overflowKey(type, color);
+        Slot* slot = findSlot(key);
+        if(slot->prototype == prototype) { return; }
+        if(slot->prototype == nullptr) { ++overflowSize_; }
+        delete slot->prototype;
+        *slot = Slot{key, prototype};
+    }
+
+    // Calls visit(type, color, prototype) for every registered prototype.
+    template<typename Visitor>
+    void forEach(Visitor visit) const
+    {
+        for(std::size_t i = 0; i < dense_.size(); ++i)
+        {
+            if(dense_[i]) { visit(static_cast<Type>(i / ColorCount), static_cast<Color>(i % ColorCount), dense_[i]); }
+        }
+        for(const Slot& slot : overflow_)
+        {
+            if(slot.prototype)
+            {
+                visit(static_cast<Type>(static_cast<std::int32_t>(slot.key >> 32)),
+                      static_cast<Color>(static_cast<std::int32_t>(slot.key & 0xFFFFFFFFu)), slot.prototype);
+            }
+        }
+    }
+
+    std::size_t size() const
+    {
+        std::size_t count = overflowSize_;
+        for(Prototype* prototype : dense_)
+        {
+            if(prototype) { ++count; }
+        }
+        return count;
+    }
+
+    void clear()
+    {
+        for(Prototype*& prototype : dense_)
+        {
+            delete prototype;
+            prototype = nullptr;
+        }
+        for(Slot& slot : overflow_)
+        {
+            delete slot.prototype;
+        }
+        overflow_.clear();
+        overflowSize_ = 0;
+    }
+};
@@ -0,0 +1,213 @@
+/**
+ * Versioned binary snapshot of a prototype registry, so a big catalog does not have to be built again at startup.
+ * Loading only maps the file and checks its header. The entries are sorted by key, so a single one is found with a
+ * binary search directly in the mapping - the factory turns it back into a prototype the first time it is asked for.
+ * 
+ * Layout (native byte order):
+ *   Header  { char magic[4] = "APRS"; uint32 version; uint32 entryCount; uint32 textSize; }
+ *   Entry   { int32 type; int32 color; uint32 kind; uint32 textOffset; uint32 textLength; } x entryCount
+ *   Text    textSize bytes, referenced by the entries
+ * @note POSIX only (open/mmap).
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ */
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// One prototype as the snapshot keeps it - its key, its kind and the text it is rebuilt from.
+struct SnapshotEntry
+{
+    std::int32_t type;
+    std::int32_t color;
+    std::uint32_t kind;
+    std::string_view text;
+};
+
+class PrototypeSnapshot
+{
+    public:
+    static constexpr std::uint32_t Version = 1;
+
+    private:
+    struct Header
+    {
+        char magic[4];
+        std::uint32_t version;
+        std::uint32_t entryCount;
+        std::uint32_t textSize;
+    };
+    struct Entry
+    {
+        std::int32_t type;
+        std::int32_t color;
+        std::uint32_t kind;
+        std::uint32_t textOffset;
+        std::uint32_t textLength;
+    };
+    static constexpr char Magic[4] = {'A', 'P', 'R', 'S'};
+
+    const char* mapping_;
+    std::size_t mappingSize_;
+    std::uint32_t entryCount_;
+    const char* entries_;
+    const char* text_;
+    std::uint32_t textSize_;
+
+    // Copied out, the mapping gives no alignment guarantees for the entries.
+    Entry entryAt(std::size_t index) const
+    {
+        Entry entry;
+        std::memcpy(&entry, entries_ + index * sizeof(Entry), sizeof(Entry));
+        return entry;
+    }
+    SnapshotEntry expose(const Entry& entry) const
+    {
+        return SnapshotEntry{entry.type, entry.color, entry.kind, std::string_view(text_ + entry.textOffset, entry.textLength)};
+    }
+    static bool keyLess(std::int32_t type, std::int32_t color, std::int32_t otherType, std::int32_t otherColor)
+    {
+        return type != otherType ? type < otherType : color < otherColor;
+    }
+
+    void unmap()
+    {
+        if(mapping_) { ::munmap(const_cast<char*>(mapping_), mappingSize_); }
+        mapping_ = nullptr;
+        mappingSize_ = 0;
+        entryCount_ = 0;
+    }
+
+    public:
+    PrototypeSnapshot() : mapping_(nullptr), mappingSize_(0), entryCount_(0), entries_(nullptr), text_(nullptr), textSize_(0) {}
+
+    // Maps the file, a missing or malformed file (or one of another version) leaves the snapshot empty.
+    explicit PrototypeSnapshot(const std::string& path) : PrototypeSnapshot()
+    {
+        int descriptor = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if(descriptor < 0) { return; }
+        struct stat status;
+        if(::fstat(descriptor, &status) == 0 && static_cast<std::size_t>(status.st_size) >= sizeof(Header))
+        {
+            void* mapping = ::mmap(nullptr, static_cast<std::size_t>(status.st_size), PROT_READ, MAP_PRIVATE, descriptor, 0);
+            if(mapping != MAP_FAILED)
+            {
+                mapping_ = static_cast<const char*>(mapping);
+                mappingSize_ = static_cast<std::size_t>(status.st_size);
+            }
+        }
+        ::close(descriptor);
+        if(!mapping_) { return; }
+
+        Header header;
+        std::memcpy(&header, mapping_, sizeof(Header));
+        std::uint64_t expectedSize = sizeof(Header) + static_cast<std::uint64_t>(header.entryCount) * sizeof(Entry) + header.textSize;
+        if(std::memcmp(header.magic, Magic, sizeof(Magic)) != 0 || header.version != Version || expectedSize != mappingSize_)
+        {
+            unmap();
+            return;
+        }
+        entryCount_ = header.entryCount;
+        entries_ = mapping_ + sizeof(Header);
+        text_ = entries_ + static_cast<std::size_t>(entryCount_) * sizeof(Entry);
+        textSize_ = header.textSize;
+    }
+    PrototypeSnapshot(PrototypeSnapshot&& other) :
+    mapping_(std::exchange(other.mapping_, nullptr)), mappingSize_(std::exchange(other.mappingSize_, 0)),
+    entryCount_(std::exchange(other.entryCount_, 0)), entries_(other.entries_), text_(other.text_), textSize_(other.textSize_) {}
+    PrototypeSnapshot& operator=(PrototypeSnapshot&& other)
+    {
+        unmap();
+        mapping_ = std::exchange(other.mapping_, nullptr);
+        mappingSize_ = std::exchange(other.mappingSize_, 0);
+        entryCount_ = std::exchange(other.entryCount_, 0);
+        entries_ = other.entries_;
+        text_ = other.text_;
+        textSize_ = other.textSize_;
+        return *this;
+    }
+    PrototypeSnapshot(const PrototypeSnapshot&) = delete;
+    PrototypeSnapshot& operator=(const PrototypeSnapshot&) = delete;
+    ~PrototypeSnapshot() { unmap(); }
+
+    // Entry stored under the key, its text points into the mapping and lives as long as the snapshot.
+    std::optional<SnapshotEntry> find(std::int32_t type, std::int32_t color) const
+    {
+        std::size_t low = 0;
+        std::size_t high = entryCount_;
+        while(low < high)
+        {
+            std::size_t middle = low + (high - low) / 2;
+            Entry entry = entryAt(middle);
+            if(keyLess(entry.type, entry.color, type, color)) { low = middle + 1; }
+            else { high = middle; }
+        }
+        if(low < entryCount_)
+        {
+            Entry entry = entryAt(low);
+            bool textInside = static_cast<std::uint64_t>(entry.textOffset) + entry.textLength <= textSize_;
+            if(entry.type == type && entry.color == color && textInside) { return expose(entry); }
+        }
+        return std::nullopt;
+    }
+
+    // Entries with a text outside of the file are skipped, same as find does.
+    template<typename Visitor>
+    void forEach(Visitor visit) const
+    {
+        for(std::size_t i = 0; i < entryCount_; ++i)
+        {
+            Entry entry = entryAt(i);
+            if(static_cast<std::uint64_t>(entry.textOffset) + entry.textLength <= textSize_) { visit(expose(entry)); }
+        }
+    }
+
+    std::size_t size() const { return entryCount_; }
+    bool empty() const { return entryCount_ == 0; }
+
+    /// @brief Writes the entries as a snapshot. The file is written next to path and renamed over it at the end,
+    /// so a snapshot mapped from path at the same time stays intact. Duplicate keys keep their first entry.
+    /// @return false if the file could not be written.
+    static bool write(const std::string& path, std::vector<SnapshotEntry> entries)
+    {
+        std::stable_sort(entries.begin(), entries.end(), [](const SnapshotEntry& left, const SnapshotEntry& right)
+        { return keyLess(left.type, left.color, right.type, right.color); });
+        entries.erase(std::unique(entries.begin(), entries.end(), [](const SnapshotEntry& left, const SnapshotEntry& right)
+        { return left.type == right.type && left.color == right.color; }), entries.end());
+
+        std::vector<Entry> table;
+        table.reserve(entries.size());
+        std::string text;
+        for(const SnapshotEntry& entry : entries)
+        {
+            table.push_back(Entry{entry.type, entry.color, entry.kind, static_cast<std::uint32_t>(text.size()), static_cast<std::uint32_t>(entry.text.size())});
+            text.append(entry.text);
+        }
+        Header header{{Magic[0], Magic[1], Magic[2], Magic[3]}, Version, static_cast<std::uint32_t>(table.size()), static_cast<std::uint32_t>(text.size())};
+
+        std::string temporary = path + ".tmp";
+        {
+            std::ofstream file(temporary, std::ios::binary | std::ios::trunc);
+            file.write(reinterpret_cast<const char*>(&header), sizeof(Header));
+            file.write(reinterpret_cast<const char*>(table.data()), static_cast<std::streamsize>(table.size() * sizeof(Entry)));
+            file.write(text.data(), static_cast<std::streamsize>(text.size()));
+            if(!file.flush()) { std::remove(temporary.c_str()); return false; }
+        }
+        return std::rename(temporary.c_str(), path.c_str()) == 0;
+    }
+};
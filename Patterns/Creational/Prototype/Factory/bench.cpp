@@ -0,0 +1,188 @@
+// Benchmarks of the Prototype factory hot call: AnimalFactory::CreateAnimal, alone and from many threads at once,
+// and of starting a factory with a big catalog of presets.
+#include <benchmark/benchmark.h>
+#include <array>
+#include <filesystem>
+#include <map>
+#include <string>
+#include "ConcurrentAnimalFactory.h"
+#include "PrototypeFactory.h"
+
+// The factory as it was before the flat registry - two std::map lookups per clone.
+class LegacyAnimalFactory
+{
+    private:
+    std::map<LivestockType, std::map<LivestockColor, Animal*>> livestockPreset_;
+    public:
+    LegacyAnimalFactory()
+    {
+        livestockPreset_[LivestockType::LTCow][LCBlack] = new Cow("Black");
+        livestockPreset_[LivestockType::LTCow][LCBrown] = new Cow("Brown");
+        livestockPreset_[LivestockType::LTCow][LCWhite] = new Cow("White");
+        livestockPreset_[LivestockType::LTSheep][LCBlack] = new Sheep("Black");
+        livestockPreset_[LivestockType::LTSheep][LCBrown] = new Sheep("Brown");
+        livestockPreset_[LivestockType::LTSheep][LCWhite] = new Sheep("White");
+    }
+    Animal* CreateAnimal(LivestockType animalType, LivestockColor animalColor)
+    {
+        return livestockPreset_[animalType][animalColor]->clone();
+    }
+    ~LegacyAnimalFactory()
+    {
+        for(auto animalType : livestockPreset_)
+        {
+            for(auto animalColor : animalType.second)
+            {
+                delete animalColor.second;
+            }
+        }
+    }
+};
+
+template<typename Factory>
+static void benchCreateAnimal(benchmark::State& state)
+{
+    Factory factory;
+    for(auto _ : state)
+    {
+        Animal* clone = factory.CreateAnimal(LTSheep, LCWhite);
+        benchmark::DoNotOptimize(clone);
+        delete clone;
+    }
+}
+BENCHMARK_TEMPLATE(benchCreateAnimal, LegacyAnimalFactory);
+BENCHMARK_TEMPLATE(benchCreateAnimal, AnimalFactory);
+
+template<typename Factory>
+static void benchCreateAnimalMixed(benchmark::State& state)
+{
+    Factory factory;
+    unsigned int step = 0;
+    for(auto _ : state)
+    {
+        LivestockType type = static_cast<LivestockType>(step & 1);
+        LivestockColor color = static_cast<LivestockColor>(step % 3);
+        Animal* clone = factory.CreateAnimal(type, color);
+        benchmark::DoNotOptimize(clone);
+        delete clone;
+        ++step;
+    }
+}
+BENCHMARK_TEMPLATE(benchCreateAnimalMixed, LegacyAnimalFactory);
+BENCHMARK_TEMPLATE(benchCreateAnimalMixed, AnimalFactory);
+
+// Presets registered at runtime, served from the overflow table.
+static void benchCreateAnimalRegistered(benchmark::State& state)
+{
+    AnimalFactory factory;
+    const unsigned int registered = 64;
+    for(unsigned int i = 0; i < registered; ++i)
+    {
+        factory.registerPrototype(LTSheep, static_cast<LivestockColor>(LCCount + i), new Sheep("Dyed"));
+    }
+    unsigned int step = 0;
+    for(auto _ : state)
+    {
+        Animal* clone = factory.CreateAnimal(LTSheep, static_cast<LivestockColor>(LCCount + step % registered));
+        benchmark::DoNotOptimize(clone);
+        delete clone;
+        ++step;
+    }
+}
+BENCHMARK(benchCreateAnimalRegistered);
+
+// Every thread clones a small batch of mixed animals and destroys it again, the counter is clones per second over
+// all the threads. The plain factory clones with new/delete, the concurrent one recycles through its free lists.
+static const std::size_t cloneBatch = 16;
+
+static void benchSharedFactoryMalloc(benchmark::State& state)
+{
+    static AnimalFactory factory;
+    std::array<Animal*, cloneBatch> batch;
+    for(auto _ : state)
+    {
+        for(std::size_t i = 0; i < cloneBatch; ++i)
+        {
+            batch[i] = factory.CreateAnimal(static_cast<LivestockType>(i & 1), static_cast<LivestockColor>(i % 3));
+        }
+        benchmark::DoNotOptimize(batch.data());
+        for(Animal* clone : batch)
+        {
+            delete clone;
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * cloneBatch);
+}
+BENCHMARK(benchSharedFactoryMalloc)->ThreadRange(1, 64)->UseRealTime();
+
+static void benchSharedFactoryRecycled(benchmark::State& state)
+{
+    static ConcurrentAnimalFactory factory;
+    std::array<AnimalHandle, cloneBatch> batch;
+    for(auto _ : state)
+    {
+        for(std::size_t i = 0; i < cloneBatch; ++i)
+        {
+            batch[i] = factory.CreateAnimal(static_cast<LivestockType>(i & 1), static_cast<LivestockColor>(i % 3));
+        }
+        benchmark::DoNotOptimize(batch.data());
+        for(AnimalHandle& clone : batch)
+        {
+            clone.reset();
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * cloneBatch);
+}
+BENCHMARK(benchSharedFactoryRecycled)->ThreadRange(1, 64)->UseRealTime();
+
+// Catalog of catalogSize presets, every one under its own runtime color.
+static const int catalogSize = 500000;
+
+static void registerCatalog(AnimalFactory& factory)
+{
+    for(int i = 0; i < catalogSize; ++i)
+    {
+        LivestockType kind = static_cast<LivestockType>(i % 2);
+        factory.registerPrototype(kind, static_cast<LivestockColor>(LCCount + i / 2), makeAnimal(kind, "Catalog color " + std::to_string(i)));
+    }
+}
+
+// Start with every preset built up front, up to the first clone.
+static void benchColdStartEager(benchmark::State& state)
+{
+    for(auto _ : state)
+    {
+        AnimalFactory* factory = new AnimalFactory();
+        registerCatalog(*factory);
+        Animal* clone = factory->CreateAnimal(LTSheep, static_cast<LivestockColor>(LCCount + catalogSize / 4));
+        benchmark::DoNotOptimize(clone);
+        delete clone;
+        // Tearing the catalog down is not part of the start
+        state.PauseTiming();
+        delete factory;
+        state.ResumeTiming();
+    }
+}
+BENCHMARK(benchColdStartEager)->Unit(benchmark::kMillisecond);
+
+// Start from a snapshot of the same catalog, up to the first clone.
+static void benchColdStartSnapshot(benchmark::State& state)
+{
+    std::string path = (std::filesystem::temp_directory_path() / "bench_prototype_factory.snapshot").string();
+    {
+        AnimalFactory factory;
+        registerCatalog(factory);
+        factory.saveSnapshot(path);
+    }
+    for(auto _ : state)
+    {
+        AnimalFactory factory(path);
+        Animal* clone = factory.CreateAnimal(LTSheep, static_cast<LivestockColor>(LCCount + catalogSize / 4));
+        benchmark::DoNotOptimize(clone);
+        delete clone;
+    }
+    std::filesystem::remove(path);
+}
+BENCHMARK(benchColdStartSnapshot)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_MAIN();
@@ -6,108 +6,14 @@
  * 
  * @copyright Copyright (c) 2023
  */
+#include <filesystem>
 #include <iostream>
 #include <string>
 #include <vector>
 #include <map>
-
-enum LivestockType
-{
-    LTCow = 0,
-    LTSheep
-};
-
-// Consider using the preset colors
-enum LivestockColor
-{
-    LCBlack = 0,
-    LCBrown,
-    LCWhite
-};
-
-// Prototype interface
-class Animal
-{
-    protected:
-    /// @note this is a name of the spiecies not individual animal per se.
-    std::string animalName_;
-    public:
-
-    // Constructor
-    Animal() {}
-    Animal(std::string name) : animalName_(name) {}
-
-    // Cloning
-    virtual Animal* clone() const = 0;
-    virtual void show() const = 0;
-};
-
-// Concrete prototype 1
-class Cow : public Animal
-{
-    private:
-    // Additional attributes related to the concrete prototype
-    std::string patchesColor_;
-    public:
-    // Creation
-    Cow(std::string patchesColor) : Animal("Cow"), patchesColor_(patchesColor) {}
-    // Cloning
-    Animal* clone() const override
-    { return new Cow(*this); }
-    // Additional methods  
-    void show() const override 
-    { std::cout << "This is a " << animalName_ << " with " << patchesColor_ << " patches" << std::endl; }
-};
-
-// Concrete prototype 2
-class Sheep : public Animal
-{
-    private:
-    std::string woolColor_;
-    public:
-    Sheep(std::string woolColor) : Animal("Sheep"), woolColor_(woolColor) {}
-    Animal* clone() const override
-    { return new Sheep(*this); }
-    void show() const override
-    { std::cout << "This is a " << woolColor_ << " " << animalName_ << std::endl; }
-};
-
-class AnimalFactory
-{
-    private:
-    std::map<LivestockType, std::map<LivestockColor, Animal*>> livestockPreset_;
-    public:
-    // Constructor
-    AnimalFactory() 
-    {
-        // Handle cows
-        livestockPreset_[LivestockType::LTCow][LCBlack] = new Cow("Black");
-        livestockPreset_[LivestockType::LTCow][LCBrown] = new Cow("Brown");
-        livestockPreset_[LivestockType::LTCow][LCWhite] = new Cow("White");
-
-        // Handle sheeps
-        livestockPreset_[LivestockType::LTSheep][LCBlack] = new Sheep("Black");
-        livestockPreset_[LivestockType::LTSheep][LCBrown] = new Sheep("Brown");
-        livestockPreset_[LivestockType::LTSheep][LCWhite] = new Sheep("White");
-    }
-
-    // Factory method
-    Animal* CreateAnimal(LivestockType animalType, LivestockColor animalColor)
-    {
-        return livestockPreset_[animalType][animalColor]->clone();
-    }
-
-    ~AnimalFactory() 
-    {
-        for(auto animalType : livestockPreset_)
-        {
-            for(auto animalColor : animalType.second)
-            {
-                delete animalColor.second;
-            }
-        }
-    }
-};
+#include <thread>
+#include "ConcurrentAnimalFactory.h"
+#include "PrototypeFactory.h"
 
 void clienCode(AnimalFactory* factory)
 {
@@ -147,10 +53,75 @@ void clienCode(AnimalFactory* factory)
     }
 }
 
+void registrationClientCode(AnimalFactory* factory)
+{
+    // A color the enum does not know about, added while the program runs
+    const LivestockColor goldenColor = static_cast<LivestockColor>(LCCount + 1);
+    std::cout << "Register golden sheep." << std::endl;
+    factory->registerPrototype(LivestockType::LTSheep, goldenColor, new Sheep("Golden"));
+
+    Animal* goldenSheep = factory->CreateAnimal(LivestockType::LTSheep, goldenColor);
+    goldenSheep->show();
+    delete goldenSheep;
+
+    // Asking for a preset that was never registered gives nothing back
+    if(factory->CreateAnimal(LivestockType::LTCow, goldenColor) == nullptr)
+    {
+        std::cout << "There is no golden cow preset." << std::endl;
+    }
+}
+
+void concurrentClientCode()
+{
+    // All presets are in place before the workers start, from then on they only clone
+    ConcurrentAnimalFactory factory;
+    const int workerCount = 4;
+    std::vector<int> sheepCounts(workerCount, 0);
+    std::vector<std::thread> workers;
+    std::cout << "Clone 1000 white sheep on each of " << workerCount << " workers." << std::endl;
+    for(int worker = 0; worker < workerCount; worker++)
+    {
+        workers.emplace_back([&factory, &sheepCounts, worker]()
+        {
+            for(int i = 0; i < 1000; i++)
+            {
+                // The sheep is destroyed right away, its memory goes straight to the next one
+                AnimalHandle sheep = factory.CreateAnimal(LivestockType::LTSheep, LivestockColor::LCWhite);
+                sheepCounts[worker] += sheep ? 1 : 0;
+            }
+        });
+    }
+    for(auto& worker : workers)
+    {
+        worker.join();
+    }
+    for(int worker = 0; worker < workerCount; worker++)
+    {
+        std::cout << "Worker " << worker << " cloned " << sheepCounts[worker] << " sheep." << std::endl;
+    }
+}
+
+void snapshotClientCode(AnimalFactory* factory)
+{
+    // Save the presets, then start a second factory from the file - it rebuilds a preset only when it is first asked for
+    std::string path = (std::filesystem::temp_directory_path() / "prototype_factory.snapshot").string();
+    factory->saveSnapshot(path);
+    AnimalFactory restoredFactory(path);
+    std::cout << "Restored factory from a snapshot of " << restoredFactory.snapshotSize() << " presets." << std::endl;
+
+    Animal* goldenSheep = restoredFactory.CreateAnimal(LivestockType::LTSheep, static_cast<LivestockColor>(LCCount + 1));
+    goldenSheep->show();
+    delete goldenSheep;
+    std::filesystem::remove(path);
+}
+
 int main()
 {       
     AnimalFactory* aFactory = new AnimalFactory();
     clienCode(aFactory);
+    registrationClientCode(aFactory);
+    concurrentClientCode();
+    snapshotClientCode(aFactory);
     delete aFactory;
     return 0;
 }
\ No newline at end of file
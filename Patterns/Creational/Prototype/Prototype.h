@@ -0,0 +1,159 @@
+/**
+ * Classes of the Prototype example, shared by the demo (main.cpp) and its benchmark (bench.cpp).
+ * The pattern itself is described in the header of main.cpp.
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ */
+#pragma once
+
+#include <cstddef>
+#include <iostream>
+#include <memory>
+#include <new>
+#include <string>
+#include <utility>
+#include <vector>
+#include "SharedText.h"
+
+class AnimalHerd;
+
+// Prototype interface
+class Animal
+{
+    protected:
+    /// @note this is a name of the spiecies not individual animal per se - interned, so all animals of a spiecies share it.
+    SharedText animalName_;
+    public:
+
+    // Constructor
+    Animal() {}
+    Animal(std::string name) : animalName_(SharedText::intern(name)) {}
+
+    // Cloning - the fields are copy on write (see SharedText.h), so a clone shares them with its prototype
+    // until one of the two changes a field.
+    virtual Animal* clone() const = 0;
+    // Bulk cloning - constructs n clones next to each other in storage, which has to hold n * cloneSize() bytes
+    // aligned to cloneAlignment(). Returns the first clone, the clones are destroyed (not deleted) by the caller.
+    // If a clone throws, the clones already constructed are destroyed before the exception leaves.
+    virtual Animal* cloneInto(void* storage, std::size_t n) const = 0;
+    virtual std::size_t cloneSize() const = 0;
+    virtual std::size_t cloneAlignment() const = 0;
+    // n clones in one allocation, see AnimalHerd.
+    AnimalHerd cloneN(std::size_t n) const;
+    virtual void show() const = 0;
+    virtual ~Animal() {}
+};
+
+// Clones of one prototype kept in a single block of memory - one allocation and one copy loop for the whole herd.
+class AnimalHerd
+{
+    private:
+    std::byte* storage_;
+    Animal* first_;
+    std::size_t size_;
+    std::size_t stride_;
+    std::size_t alignment_;
+
+    // The clone at index, reached from the first one - the bytes in between belong to the clones, not to an Animal.
+    Animal* at(std::size_t index) const
+    { return std::launder(reinterpret_cast<Animal*>(reinterpret_cast<std::byte*>(first_) + index * stride_)); }
+
+    void destroy() noexcept
+    {
+        if(!storage_) { return; }
+        for(std::size_t i = 0; i < size_; ++i)
+        {
+            at(i)->~Animal();
+        }
+        ::operator delete(storage_, std::align_val_t(alignment_));
+        storage_ = nullptr;
+    }
+
+    public:
+    AnimalHerd() : storage_(nullptr), first_(nullptr), size_(0), stride_(0), alignment_(0) {}
+    AnimalHerd(const Animal& prototype, std::size_t n) :
+    storage_(nullptr), first_(nullptr), size_(n), stride_(prototype.cloneSize()), alignment_(prototype.cloneAlignment())
+    {
+        if(n == 0) { return; }
+        storage_ = static_cast<std::byte*>(::operator new(n * stride_, std::align_val_t(alignment_)));
+        try
+        {
+            first_ = prototype.cloneInto(storage_, n);
+        }
+        catch(...)
+        {
+            // cloneInto has destroyed the clones it made, only the memory is left
+            ::operator delete(storage_, std::align_val_t(alignment_));
+            throw;
+        }
+    }
+    AnimalHerd(AnimalHerd&& other) noexcept :
+    storage_(std::exchange(other.storage_, nullptr)), first_(other.first_), size_(std::exchange(other.size_, 0)),
+    stride_(other.stride_), alignment_(other.alignment_) {}
+    AnimalHerd& operator=(AnimalHerd&& other) noexcept
+    {
+        if(this == &other) { return *this; }
+        destroy();
+        storage_ = std::exchange(other.storage_, nullptr);
+        first_ = other.first_;
+        size_ = std::exchange(other.size_, 0);
+        stride_ = other.stride_;
+        alignment_ = other.alignment_;
+        return *this;
+    }
+    AnimalHerd(const AnimalHerd&) = delete;
+    AnimalHerd& operator=(const AnimalHerd&) = delete;
+    ~AnimalHerd() { destroy(); }
+
+    Animal& operator[](std::size_t index) { return *at(index); }
+    const Animal& operator[](std::size_t index) const { return *at(index); }
+    std::size_t size() const { return size_; }
+};
+
+inline AnimalHerd Animal::cloneN(std::size_t n) const
+{
+    return AnimalHerd(*this, n);
+}
+
+// Concrete prototype 1
+class Cow : public Animal
+{
+    private:
+    // Additional attributes related to the concrete prototype
+    SharedText patchesColor_;
+    public:
+    // Creation
+    Cow(std::string patchesColor) : Animal("Cow"), patchesColor_(patchesColor) {}
+    void setPatchesColor(std::string patchesColor)
+    { patchesColor_.assign(patchesColor); }
+    // Cloning
+    Animal* clone() const override
+    { return new Cow(*this); }
+    Animal* cloneInto(void* storage, std::size_t n) const override
+    { return std::uninitialized_fill_n(static_cast<Cow*>(storage), n, *this) - n; }
+    std::size_t cloneSize() const override { return sizeof(Cow); }
+    std::size_t cloneAlignment() const override { return alignof(Cow); }
+    // Additional methods  
+    void show() const override 
+    { std::cout << "This is a " << animalName_ << " with " << patchesColor_ << " patches" << std::endl; }
+};
+
+// Concrete prototype 2
+class Sheep : public Animal
+{
+    private:
+    SharedText woolColor_;
+    public:
+    Sheep(std::string woolColor) : Animal("Sheep"), woolColor_(woolColor) {}
+    void setWoolColor(std::string woolColor)
+    { woolColor_.assign(woolColor); }
+    Animal* clone() const override
+    { return new Sheep(*this); }
+    Animal* cloneInto(void* storage, std::size_t n) const override
+    { return std::uninitialized_fill_n(static_cast<Sheep*>(storage), n, *this) - n; }
+    std::size_t cloneSize() const override { return sizeof(Sheep); }
+    std::size_t cloneAlignment() const override { return alignof(Sheep); }
+    void show() const override
+    { std::cout << "This is a " << woolColor_ << " " << animalName_ << std::endl; }
+};
@@ -0,0 +1,91 @@
+/**
+ * Immutable, reference counted text used for the fields of the prototypes. Copying a SharedText only bumps a counter,
+ * so a clone shares the text of its prototype until one of them writes the field - a write never changes the shared
+ * text, it points the written object to a private copy instead (copy on write).
+ * Texts repeated by every object of a kind, like the species name, can be interned so that all of them share one copy.
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ */
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+
+class SharedText
+{
+    private:
+    struct Block
+    {
+        std::atomic<std::size_t> references;
+        const std::string text;
+
+        explicit Block(std::string value) : references(1), text(std::move(value)) {}
+    };
+    Block* block_;
+
+    explicit SharedText(Block* block) : block_(block) {}
+
+    void acquire() const { block_->references.fetch_add(1, std::memory_order_relaxed); }
+    void release()
+    {
+        if(block_->references.fetch_sub(1, std::memory_order_acq_rel) == 1) { delete block_; }
+    }
+
+    public:
+    explicit SharedText(std::string text = std::string()) : block_(new Block(std::move(text))) {}
+    SharedText(const SharedText& other) : block_(other.block_) { acquire(); }
+    SharedText& operator=(const SharedText& other)
+    {
+        other.acquire();
+        release();
+        block_ = other.block_;
+        return *this;
+    }
+    ~SharedText() { release(); }
+
+    // Shared copy of the one interned instance of the text. Interned texts live until the program ends.
+    static SharedText intern(std::string_view text)
+    {
+        static std::mutex lock;
+        static std::unordered_map<std::string_view, std::unique_ptr<Block>> interned;
+
+        std::lock_guard<std::mutex> guard(lock);
+        auto entry = interned.find(text);
+        if(entry == interned.end())
+        {
+            // The table keeps the first reference, so the block (and the key viewing into it) is never freed.
+            auto block = std::make_unique<Block>(std::string(text));
+            std::string_view key = block->text;
+            entry = interned.emplace(key, std::move(block)).first;
+        }
+        SharedText shared(entry->second.get());
+        shared.acquire();
+        return shared;
+    }
+
+    // Writing - the shared text stays as it is, this object gets a text of its own.
+    void assign(std::string text)
+    {
+        // Allocated first, so a failed allocation leaves the old text in place
+        Block* fresh = new Block(std::move(text));
+        release();
+        block_ = fresh;
+    }
+
+    const std::string& str() const { return block_->text; }
+    // True if another object holds the same text.
+    bool isShared() const { return block_->references.load(std::memory_order_relaxed) > 1; }
+};
+
+inline std::ostream& operator<<(std::ostream& stream, const SharedText& text)
+{
+    return stream << text.str();
+}
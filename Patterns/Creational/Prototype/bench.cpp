@@ -0,0 +1,146 @@
+// Benchmarks of the Prototype hot call: cloning a prototype through the Animal interface,
+// cloning whole herds at once, and the memory a herd of clones takes with copy on write fields against fully copied ones.
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+#include <unistd.h>
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif
+#include "Prototype.h"
+
+// The Cow as it was before the fields were shared - every clone copies both strings.
+class LegacyCow : public Animal
+{
+    private:
+    std::string legacyName_;
+    std::string patchesColor_;
+    public:
+    LegacyCow(std::string patchesColor) : legacyName_("Cow"), patchesColor_(patchesColor) {}
+    Animal* clone() const override
+    { return new LegacyCow(*this); }
+    Animal* cloneInto(void* storage, std::size_t n) const override
+    { return std::uninitialized_fill_n(static_cast<LegacyCow*>(storage), n, *this) - n; }
+    std::size_t cloneSize() const override { return sizeof(LegacyCow); }
+    std::size_t cloneAlignment() const override { return alignof(LegacyCow); }
+    void show() const override
+    { std::cout << "This is a " << legacyName_ << " with " << patchesColor_ << " patches" << std::endl; }
+};
+
+static void benchCloneCow(benchmark::State& state)
+{
+    std::unique_ptr<Animal> prototype(new Cow("brown"));
+    for(auto _ : state)
+    {
+        Animal* clone = prototype->clone();
+        benchmark::DoNotOptimize(clone);
+        delete clone;
+    }
+}
+BENCHMARK(benchCloneCow);
+
+static void benchCloneLegacyCow(benchmark::State& state)
+{
+    std::unique_ptr<Animal> prototype(new LegacyCow("brown"));
+    for(auto _ : state)
+    {
+        Animal* clone = prototype->clone();
+        benchmark::DoNotOptimize(clone);
+        delete clone;
+    }
+}
+BENCHMARK(benchCloneLegacyCow);
+
+static void benchCloneSheep(benchmark::State& state)
+{
+    std::unique_ptr<Animal> prototype(new Sheep("white"));
+    for(auto _ : state)
+    {
+        Animal* clone = prototype->clone();
+        benchmark::DoNotOptimize(clone);
+        delete clone;
+    }
+}
+BENCHMARK(benchCloneSheep);
+
+// A herd of 1M clones one by one, the way clienCode builds its farm - a virtual call and an allocation per clone.
+static void benchHerdPerClone(benchmark::State& state)
+{
+    const std::size_t herdSize = 1000000;
+    std::unique_ptr<Animal> prototype(new Cow("brown"));
+    for(auto _ : state)
+    {
+        std::vector<Animal*> herd;
+        for(std::size_t i = 0; i < herdSize; ++i)
+        {
+            herd.push_back(prototype->clone());
+        }
+        benchmark::DoNotOptimize(herd.data());
+        for(Animal* animal : herd)
+        {
+            delete animal;
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * herdSize);
+}
+BENCHMARK(benchHerdPerClone)->Unit(benchmark::kMillisecond);
+
+// The same herd with cloneN - one allocation and one copy loop.
+static void benchHerdCloneN(benchmark::State& state)
+{
+    const std::size_t herdSize = 1000000;
+    std::unique_ptr<Animal> prototype(new Cow("brown"));
+    for(auto _ : state)
+    {
+        AnimalHerd herd = prototype->cloneN(herdSize);
+        benchmark::DoNotOptimize(&herd[herdSize - 1]);
+    }
+    state.SetItemsProcessed(state.iterations() * herdSize);
+}
+BENCHMARK(benchHerdCloneN)->Unit(benchmark::kMillisecond);
+
+// Resident set size of the process, from /proc (Linux).
+static std::size_t residentBytes()
+{
+    std::size_t totalPages = 0;
+    std::size_t residentPages = 0;
+    std::ifstream("/proc/self/statm") >> totalPages >> residentPages;
+    return residentPages * static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+}
+
+// Clones a 10M herd and reports how much the resident size grew per clone. The color is longer than the small
+// string buffer, as real descriptions are, so the fully copied clone has to allocate it.
+template<typename Prototype>
+static void benchHerdMemory(benchmark::State& state)
+{
+    const std::size_t herdSize = 10000000;
+    std::unique_ptr<Animal> prototype(new Prototype("brown and white, with a black spot on the left ear"));
+    for(auto _ : state)
+    {
+        std::vector<Animal*> herd(herdSize, nullptr);
+        std::size_t before = residentBytes();
+        for(Animal*& animal : herd)
+        {
+            animal = prototype->clone();
+        }
+        std::size_t after = residentBytes();
+        state.counters["bytes/clone"] = static_cast<double>(after - before) / herdSize;
+        state.counters["herd_MiB"] = static_cast<double>(after - before) / (1024.0 * 1024.0);
+
+        for(Animal* animal : herd)
+        {
+            delete animal;
+        }
+    }
+#ifdef __GLIBC__
+    // Hand the freed clones back to the system, so the next run starts from the same resident size.
+    malloc_trim(0);
+#endif
+}
+BENCHMARK_TEMPLATE(benchHerdMemory, LegacyCow)->Iterations(1)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(benchHerdMemory, Cow)->Iterations(1)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
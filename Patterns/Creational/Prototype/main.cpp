@@ -9,54 +9,7 @@
 #include <iostream>
 #include <string>
 #include <vector>
-
-// Prototype interface
-class Animal
-{
-    protected:
-    /// @note this is a name of the spiecies not individual animal per se.
-    std::string animalName_;
-    public:
-
-    // Constructor
-    Animal() {}
-    Animal(std::string name) : animalName_(name) {}
-
-    // Cloning
-    virtual Animal* clone() const = 0;
-    virtual void show() const = 0;
-    virtual ~Animal() {}
-};
-
-// Concrete prototype 1
-class Cow : public Animal
-{
-    private:
-    // Additional attributes related to the concrete prototype
-    std::string patchesColor_;
-    public:
-    // Creation
-    Cow(std::string patchesColor) : Animal("Cow"), patchesColor_(patchesColor) {}
-    // Cloning
-    Animal* clone() const override
-    { return new Cow(*this); }
-    // Additional methods  
-    void show() const override 
-    { std::cout << "This is a " << animalName_ << " with " << patchesColor_ << " patches" << std::endl; }
-};
-
-// Concrete prototype 2
-class Sheep : public Animal
-{
-    private:
-    std::string woolColor_;
-    public:
-    Sheep(std::string woolColor) : Animal("Sheep"), woolColor_(woolColor) {}
-    Animal* clone() const override
-    { return new Sheep(*this); }
-    void show() const override
-    { std::cout << "This is a " << woolColor_ << " " << animalName_ << std::endl; }
-};
+#include "Prototype.h"
 
 void clienCode()
 {
@@ -88,6 +41,12 @@ void clienCode()
         animalFarm.push_back(sheepWhite->clone());
     }    
 
+    // Fields are copy on write - dyeing one clone leaves its prototype and the other clones as they were
+    std::cout << "Dyeing the wool of one more cloned sheep." << std::endl;
+    Sheep* sheepDyed = static_cast<Sheep*>(sheepWhite->clone());
+    sheepDyed->setWoolColor("blue");
+    animalFarm.push_back(sheepDyed);
+
     // Display animals
     for(auto livestock : animalFarm)
     {
@@ -102,8 +61,29 @@ void clienCode()
     }
 }
 
+void herdClientCode()
+{
+    std::cout << "Cloning a herd of 4 brown cows and a flock of 3 black sheeps at once." << std::endl;
+    Cow cowPrototype("brown");
+    Sheep sheepPrototype("black");
+
+    // Every herd is one block of memory, the clones are destroyed together with it.
+    AnimalHerd cows = cowPrototype.cloneN(4);
+    AnimalHerd sheeps = sheepPrototype.cloneN(3);
+
+    for(std::size_t i = 0; i < cows.size(); i++)
+    {
+        cows[i].show();
+    }
+    for(std::size_t i = 0; i < sheeps.size(); i++)
+    {
+        sheeps[i].show();
+    }
+}
+
 int main()
 {
     clienCode();
+    herdClientCode();
     return 0;
 }
\ No newline at end of file
@@ -0,0 +1,170 @@
+/**
+ * Loading of the configuration from a key/value file, and watching the file for changes.
+ * The file is memory mapped and parsed straight from the mapping into a new ConfigSnapshot, the mapping is closed
+ * again before the snapshot is published, so readers never touch the file. Changes are detected by polling stat().
+ * Format - one "key = value" per line, blank lines and lines starting with # are skipped.
+ * @note POSIX only (open/mmap/stat). Replace the file atomically (write a temporary file, then rename it over),
+ * a file truncated in place while it is being parsed can not be read safely.
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ */
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "ConfigSnapshot.h"
+
+// Read only view of a whole file, unmapped on destruction.
+class MappedFile
+{
+    private:
+    const char* data_;
+    std::size_t size_;
+
+    public:
+    explicit MappedFile(const std::string& path) : data_(nullptr), size_(0)
+    {
+        int descriptor = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if(descriptor < 0) { return; }
+        struct stat status;
+        if(::fstat(descriptor, &status) == 0 && status.st_size > 0)
+        {
+            void* mapping = ::mmap(nullptr, static_cast<std::size_t>(status.st_size), PROT_READ, MAP_PRIVATE, descriptor, 0);
+            if(mapping != MAP_FAILED)
+            {
+                data_ = static_cast<const char*>(mapping);
+                size_ = static_cast<std::size_t>(status.st_size);
+                ::madvise(mapping, size_, MADV_SEQUENTIAL);
+            }
+        }
+        ::close(descriptor);
+    }
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    ~MappedFile()
+    {
+        if(data_) { ::munmap(const_cast<char*>(data_), size_); }
+    }
+
+    bool isOpen() const { return data_ != nullptr; }
+    std::string_view contents() const { return std::string_view(data_, size_); }
+};
+
+inline std::string_view trimConfigText(std::string_view text)
+{
+    const std::string_view blanks = " \t\r";
+    std::size_t first = text.find_first_not_of(blanks);
+    if(first == std::string_view::npos) { return std::string_view(); }
+    return text.substr(first, text.find_last_not_of(blanks) - first + 1);
+}
+
+/// @brief Parses the whole file into a fresh snapshot. The first occurrence of a key wins.
+/// @return nullptr if the file can not be opened or is empty.
+inline std::shared_ptr<ConfigSnapshot> loadConfigFile(const std::string& path)
+{
+    MappedFile file(path);
+    if(!file.isOpen()) { return nullptr; }
+
+    auto values = std::make_shared<ConfigSnapshot>();
+    std::string_view rest = file.contents();
+    while(!rest.empty())
+    {
+        std::size_t lineEnd = rest.find('\n');
+        std::string_view line = trimConfigText(rest.substr(0, lineEnd));
+        rest = lineEnd == std::string_view::npos ? std::string_view() : rest.substr(lineEnd + 1);
+
+        std::size_t separator = line.find('=');
+        if(line.empty() || line.front() == '#' || separator == std::string_view::npos) { continue; }
+        values->insert(trimConfigText(line.substr(0, separator)), std::string(trimConfigText(line.substr(separator + 1))));
+    }
+    return values;
+}
+
+// Polls a file on its own thread and calls onChange each time the file was replaced or modified.
+class ConfigFileWatcher
+{
+    private:
+    struct FileStamp
+    {
+        ino_t inode = 0;
+        off_t size = 0;
+        struct timespec modified = {};
+
+        bool operator==(const FileStamp& other) const
+        {
+            return inode == other.inode && size == other.size &&
+                   modified.tv_sec == other.modified.tv_sec && modified.tv_nsec == other.modified.tv_nsec;
+        }
+    };
+    std::string path_;
+    std::chrono::milliseconds interval_;
+    std::function<void()> onChange_;
+    std::mutex lock_;
+    std::condition_variable wake_;
+    bool stopping_;
+    FileStamp seen_;
+    std::thread thread_;
+
+    static FileStamp stampOf(const std::string& path)
+    {
+        FileStamp stamp;
+        struct stat status;
+        if(::stat(path.c_str(), &status) == 0)
+        {
+            stamp.inode = status.st_ino;
+            stamp.size = status.st_size;
+            stamp.modified = status.st_mtim;
+        }
+        return stamp;
+    }
+
+    void poll()
+    {
+        std::unique_lock<std::mutex> lock(lock_);
+        while(!wake_.wait_for(lock, interval_, [this]() { return stopping_; }))
+        {
+            FileStamp current = stampOf(path_);
+            if(current == seen_) { continue; }
+            seen_ = current;
+            // Reloading runs without the lock, so the destructor can flag the stop in the meantime.
+            lock.unlock();
+            onChange_();
+            lock.lock();
+        }
+    }
+
+    public:
+    // The file as it is now counts as seen - load it after starting the watcher.
+    ConfigFileWatcher(std::string path, std::chrono::milliseconds interval, std::function<void()> onChange) :
+    path_(std::move(path)), interval_(interval), onChange_(std::move(onChange)), lock_(), wake_(), stopping_(false),
+    seen_(stampOf(path_)), thread_()
+    {
+        thread_ = std::thread([this]() { poll(); });
+    }
+    ConfigFileWatcher(const ConfigFileWatcher&) = delete;
+    ConfigFileWatcher& operator=(const ConfigFileWatcher&) = delete;
+    ~ConfigFileWatcher()
+    {
+        {
+            std::lock_guard<std::mutex> lock(lock_);
+            stopping_ = true;
+        }
+        wake_.notify_one();
+        thread_.join();
+    }
+
+    const std::string& path() const { return path_; }
+};
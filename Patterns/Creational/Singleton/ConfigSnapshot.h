@@ -0,0 +1,213 @@
+/**
+ * Storage of the configuration values. Keys known at build time are placed with a perfect hash generated at compile
+ * time, so looking them up is one hash, one compare and no allocation. Any other key goes into a fallback map.
+ * Every value is parsed once, when the snapshot is built, so the typed accessors never parse on a read.
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ */
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// Keys the application knows about at build time - new well known keys go here.
+inline constexpr std::array<std::string_view, 8> KnownConfigKeys =
+{
+    "ConfigCreated", "WindowSize", "WindowTitle", "Fullscreen", "FontSize", "Theme", "Language", "VSync"
+};
+
+// Compile time perfect hash over KnownConfigKeys
+struct KnownKeyTable
+{
+    static constexpr std::size_t Size = 16;
+    static constexpr std::uint8_t Empty = 0xFF;
+    std::uint32_t seed;
+    std::array<std::uint8_t, Size> slots;
+};
+static_assert(KnownConfigKeys.size() <= KnownKeyTable::Size, "Grow KnownKeyTable::Size together with KnownConfigKeys");
+
+constexpr std::uint32_t knownKeyHash(std::string_view key, std::uint32_t seed)
+{
+    // FNV-1a with the seed mixed into the offset basis
+    std::uint32_t value = 2166136261u ^ seed;
+    for(char c : key)
+    {
+        value ^= static_cast<unsigned char>(c);
+        value *= 16777619u;
+    }
+    return value;
+}
+
+// Tries seeds until every known key lands in its own slot.
+constexpr KnownKeyTable buildKnownKeyTable()
+{
+    for(std::uint32_t seed = 0; seed < 100000; ++seed)
+    {
+        KnownKeyTable table{seed, {}};
+        for(auto& slot : table.slots) { slot = KnownKeyTable::Empty; }
+        bool collision = false;
+        for(std::size_t i = 0; i < KnownConfigKeys.size() && !collision; ++i)
+        {
+            std::uint8_t& slot = table.slots[knownKeyHash(KnownConfigKeys[i], seed) % KnownKeyTable::Size];
+            collision = slot != KnownKeyTable::Empty;
+            slot = static_cast<std::uint8_t>(i);
+        }
+        if(!collision) { return table; }
+    }
+    throw "No perfect hash seed found for KnownConfigKeys";
+}
+
+inline constexpr KnownKeyTable knownKeyTable = buildKnownKeyTable();
+
+// Index of the key in KnownConfigKeys, or -1 for a key that is not known at build time.
+constexpr int knownKeyIndex(std::string_view key)
+{
+    std::uint8_t slot = knownKeyTable.slots[knownKeyHash(key, knownKeyTable.seed) % KnownKeyTable::Size];
+    return slot != KnownKeyTable::Empty && KnownConfigKeys[slot] == key ? slot : -1;
+}
+
+static_assert(knownKeyIndex("WindowSize") == 1, "Perfect hash of the known keys is broken");
+static_assert(knownKeyIndex("NotAKey") == -1, "Perfect hash of the known keys is broken");
+
+// One value, with its typed forms parsed up front. A number has to be the whole text, or be followed by nothing but a
+// unit made of letters, so "25px" is 25 while "1.5" is no integer and "12ab3" no number at all.
+struct ConfigEntry
+{
+    std::string text;
+    std::optional<long long> asInteger;
+    std::optional<double> asReal;
+    std::optional<bool> asBool;
+
+    static bool isUnit(const char* first, const char* last)
+    {
+        return std::all_of(first, last, [](char c) { return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z'); });
+    }
+
+    explicit ConfigEntry(std::string value) : text(std::move(value)), asInteger(), asReal(), asBool()
+    {
+        const char* first = text.data();
+        const char* last = text.data() + text.size();
+        long long integer = 0;
+        std::from_chars_result parsed = std::from_chars(first, last, integer);
+        if(parsed.ec == std::errc() && isUnit(parsed.ptr, last))
+        {
+            asInteger = integer;
+        }
+        double real = 0;
+        parsed = std::from_chars(first, last, real);
+        if(parsed.ec == std::errc() && isUnit(parsed.ptr, last))
+        {
+            asReal = real;
+        }
+        if(text == "true") { asBool = true; }
+        else if(text == "false") { asBool = false; }
+    }
+};
+
+// Immutable once published - every change builds a new snapshot.
+class ConfigSnapshot
+{
+    private:
+    std::array<std::optional<ConfigEntry>, KnownConfigKeys.size()> known_;
+    std::map<std::string, ConfigEntry, std::less<>> dynamic_;
+
+    const ConfigEntry* findEntry(std::string_view field) const
+    {
+        int index = knownKeyIndex(field);
+        if(index >= 0)
+        {
+            return known_[index] ? &*known_[index] : nullptr;
+        }
+        auto entry = dynamic_.find(field);
+        return entry != dynamic_.end() ? &entry->second : nullptr;
+    }
+
+    public:
+    // Same as std::map::insert - an existing field keeps its value. Returns true if the field was added.
+    bool insert(std::string_view field, std::string value)
+    {
+        int index = knownKeyIndex(field);
+        if(index >= 0)
+        {
+            if(known_[index]) { return false; }
+            known_[index].emplace(std::move(value));
+            return true;
+        }
+        if(dynamic_.find(field) != dynamic_.end()) { return false; }
+        dynamic_.emplace(std::string(field), ConfigEntry(std::move(value)));
+        return true;
+    }
+
+    // Text of the value, nullptr if the field is not set.
+    const std::string* find(std::string_view field) const
+    {
+        const ConfigEntry* entry = findEntry(field);
+        return entry ? &entry->text : nullptr;
+    }
+
+    /// @brief Typed value - int, long long, double, bool, std::string or std::string_view.
+    /// @return Empty if the field is not set, its text is not of that type or the number does not fit into T.
+    template<typename T>
+    std::optional<T> get(std::string_view field) const
+    {
+        const ConfigEntry* entry = findEntry(field);
+        if(!entry) { return std::nullopt; }
+
+        if constexpr(std::is_same_v<T, bool>)
+        {
+            return entry->asBool;
+        }
+        else if constexpr(std::is_integral_v<T>)
+        {
+            if(!entry->asInteger) { return std::nullopt; }
+            long long integer = *entry->asInteger;
+            if constexpr(std::is_unsigned_v<T>)
+            {
+                if(integer < 0 || static_cast<unsigned long long>(integer) > std::numeric_limits<T>::max()) { return std::nullopt; }
+            }
+            else
+            {
+                if(integer < std::numeric_limits<T>::min() || integer > std::numeric_limits<T>::max()) { return std::nullopt; }
+            }
+            return static_cast<T>(integer);
+        }
+        else if constexpr(std::is_floating_point_v<T>)
+        {
+            if(!entry->asReal) { return std::nullopt; }
+            return static_cast<T>(*entry->asReal);
+        }
+        else
+        {
+            static_assert(std::is_same_v<T, std::string> || std::is_same_v<T, std::string_view>, "Unsupported configuration value type");
+            return T(entry->text);
+        }
+    }
+
+    // Every field with its text, in key order.
+    std::vector<std::pair<std::string_view, std::string_view>> entries() const
+    {
+        std::vector<std::pair<std::string_view, std::string_view>> all;
+        for(std::size_t i = 0; i < known_.size(); ++i)
+        {
+            if(known_[i]) { all.emplace_back(KnownConfigKeys[i], known_[i]->text); }
+        }
+        for(const auto& entry : dynamic_)
+        {
+            all.emplace_back(entry.first, entry.second.text);
+        }
+        std::sort(all.begin(), all.end());
+        return all;
+    }
+};
@@ -0,0 +1,223 @@
+/**
+ * Classes of the Singleton example, shared by the demo (main.cpp) and its benchmark (bench.cpp).
+ * The pattern itself is described in the header of main.cpp.
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ */
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+#include "ConfigFile.h"
+#include "ConfigSnapshot.h"
+
+// An example of an application element that can be only one within the software.
+// Creation is race free, readers work on immutable snapshots (RCU style) and never lock in the steady state,
+// writers are serialized and publish a new snapshot per batch of changes.
+// The values can also come from a file, which is reloaded in the background whenever it changes.
+class Configuration
+{
+    private:
+    std::shared_ptr<const ConfigSnapshot> configValues_;   // Accessed only through std::atomic_load/std::atomic_store
+    std::atomic<std::uint64_t> version_;
+    std::mutex writerLock_;
+    std::mutex reloadLock_;    // Serializes file loads, parse and publish together
+    std::vector<std::shared_ptr<const ConfigSnapshot>> retired_;   // Replaced snapshots some reader may still hold
+    std::mutex watcherLock_;
+    std::unique_ptr<ConfigFileWatcher> watcher_;   // Last member, so its thread is stopped before anything else goes
+
+    // Versions are unique across all instances, so a cached snapshot can never be mistaken for one of a newer instance.
+    static std::uint64_t nextVersion()
+    {
+        static std::atomic<std::uint64_t> counter(0);
+        return counter.fetch_add(1, std::memory_order_relaxed) + 1;
+    }
+    // Every thread caches the last snapshot it has seen, and takes a new one only after a writer has published.
+    struct ReaderCache
+    {
+        std::uint64_t version = 0;
+        std::shared_ptr<const ConfigSnapshot> values;
+    };
+
+    // Called with writerLock_ held. The replaced snapshot is kept until no reader holds it any more and is freed
+    // here, by a writer - otherwise the last reader to let go of it would pay for freeing a whole snapshot.
+    void publish(std::shared_ptr<const ConfigSnapshot> values)
+    {
+        retired_.push_back(std::atomic_exchange_explicit(&configValues_, std::move(values), std::memory_order_acq_rel));
+        version_.store(nextVersion(), std::memory_order_release);
+        // A retired snapshot can not be picked up again, so once only retired_ holds it, nobody else can.
+        retired_.erase(std::remove_if(retired_.begin(), retired_.end(),
+            [](const std::shared_ptr<const ConfigSnapshot>& values) { return values.use_count() == 1; }), retired_.end());
+    }
+    protected:
+    // Creation process
+    static std::atomic<Configuration*> globalConfig_;
+    static std::mutex creationLock_;
+    Configuration(std::pair<std::string, std::string> headerFields) :
+    configValues_(), version_(0), writerLock_(), reloadLock_(), retired_(), watcherLock_(), watcher_()
+    {
+        auto values = std::make_shared<ConfigSnapshot>();
+        values->insert(headerFields.first, std::move(headerFields.second));
+        configValues_ = std::move(values);
+        version_.store(nextVersion(), std::memory_order_release);
+    }
+    public:
+    // Core Singleton functionality.
+    static Configuration* getInstance()
+    {
+        // Double checked - once the instance exists, getting it is a single atomic load.
+        Configuration* instance = globalConfig_.load(std::memory_order_acquire);
+        if(instance == nullptr)
+        {
+            std::lock_guard<std::mutex> lock(creationLock_);
+            instance = globalConfig_.load(std::memory_order_relaxed);
+            if(instance == nullptr)
+            {
+                std::cout << "No config found. Creating new one." << std::endl;
+                instance = new Configuration(std::make_pair("ConfigCreated", "true"));
+                globalConfig_.store(instance, std::memory_order_release);
+                return instance;
+            }
+        }
+
+        std::cout << "Returning existing config" << std::endl;
+        return instance;
+    }
+
+    private:
+    // The calling thread's cache, brought up to date. Up to date it costs one atomic load and no reference counting.
+    ReaderCache& readerCache() const
+    {
+        thread_local ReaderCache cache;
+        std::uint64_t current = version_.load(std::memory_order_acquire);
+        if(cache.version != current)
+        {
+            cache.values = std::atomic_load_explicit(&configValues_, std::memory_order_acquire);
+            cache.version = current;
+        }
+        return cache;
+    }
+    // Current values, kept alive by the thread's cache until this thread reads again after a change.
+    const ConfigSnapshot& current() const { return *readerCache().values; }
+
+    public:
+    // Current values, for callers that have to hold them. The snapshot stays valid (and unchanged) for as long as it
+    // is held - getConfig and get do without it, so the reads of many threads do not contend on its reference count.
+    std::shared_ptr<const ConfigSnapshot> snapshot() const
+    {
+        return readerCache().values;
+    }
+
+    // Copy of a single value, empty if the field is not set.
+    std::string getConfig(std::string_view field) const
+    {
+        const std::string* value = current().find(field);
+        return value ? *value : std::string();
+    }
+
+    // Value already parsed into T (see ConfigSnapshot::get), empty if the field is not set or is not a T.
+    /// @note A std::string_view result points into the current snapshot, hold snapshot() to keep it alive.
+    template<typename T>
+    std::optional<T> get(std::string_view field) const
+    {
+        return current().get<T>(field);
+    }
+
+    // Publishes all the changes as one new snapshot. Fields that already exist keep their value.
+    void addConfigs(const std::vector<std::pair<std::string, std::string>>& fields)
+    {
+        std::lock_guard<std::mutex> lock(writerLock_);
+        // The new snapshot is built and parsed here, before it is published, so readers never parse.
+        auto values = std::make_shared<ConfigSnapshot>(*std::atomic_load_explicit(&configValues_, std::memory_order_acquire));
+        for(const auto& field : fields)
+        {
+            values->insert(field.first, field.second);
+        }
+        publish(std::move(values));
+    }
+
+    /// @brief Replaces all the values with the contents of a key/value file (see ConfigFile.h).
+    /// The file is parsed before the writer lock is taken, readers keep using the old values until the swap.
+    /// Loads run one at a time from the parse to the publish, so a load that read the file earlier can never publish
+    /// after one that read it later.
+    /// @return false if the file could not be read, the current values are kept then.
+    bool loadFile(const std::string& path)
+    {
+        std::lock_guard<std::mutex> reload(reloadLock_);
+        std::shared_ptr<ConfigSnapshot> values = loadConfigFile(path);
+        if(!values) { return false; }
+
+        std::lock_guard<std::mutex> lock(writerLock_);
+        publish(std::move(values));
+        return true;
+    }
+
+    // Loads the file, then reloads it in the background every time it changes on disk.
+    bool watchFile(const std::string& path, std::chrono::milliseconds pollInterval = std::chrono::milliseconds(100))
+    {
+        std::lock_guard<std::mutex> lock(watcherLock_);
+        watcher_.reset();
+        // Watching starts first, so a change made while the file is being loaded is not missed.
+        watcher_ = std::make_unique<ConfigFileWatcher>(path, pollInterval, [this, path]() { loadFile(path); });
+        return loadFile(path);
+    }
+
+    void stopWatching()
+    {
+        std::lock_guard<std::mutex> lock(watcherLock_);
+        watcher_.reset();
+    }
+
+    // Method related to function class
+    void addConfig(std::string field, std::string value)
+    {
+        Configuration* instance = globalConfig_.load(std::memory_order_acquire);
+        if(instance == nullptr)
+        {
+            std::cout << "Cannot add config! Configuration instance is null." << std::endl;
+            return;
+        }
+
+        instance->addConfigs({std::make_pair(field, value)});
+        std::cout << "Added " << field << " with value of " << value  << " to the config." << std::endl;
+    }
+
+    void show()
+    {
+        Configuration* instance = globalConfig_.load(std::memory_order_acquire);
+        if(instance == nullptr)
+        {
+            std::cout << "Cannot show config! Configuration instance is null." << std::endl;
+            return;
+        }
+
+        std::cout << "Format:" << std::endl;        
+        std::shared_ptr<const ConfigSnapshot> values = instance->snapshot();
+        for(const auto& entry : values->entries()) 
+        { 
+            std::cout << entry.first << ": " << entry.second << std::endl;
+        }        
+    }
+
+    // Allows for destruction of singleton pointer
+    /// @note No other thread may use the instance while it is being reset.
+    void resetInstance()
+    { 
+        std::lock_guard<std::mutex> lock(creationLock_);
+        delete globalConfig_.exchange(nullptr, std::memory_order_acq_rel);
+    }
+};
+
+inline std::atomic<Configuration*> Configuration::globalConfig_(nullptr);
+inline std::mutex Configuration::creationLock_;
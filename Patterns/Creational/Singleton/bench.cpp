@@ -0,0 +1,288 @@
+// Benchmarks of the Singleton hot calls: getting the instance, adding to the configuration and reading from it,
+// plus loading and hot reloading the configuration from a file.
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+#include "Singleton.h"
+#include "QuietOutput.h"
+
+static void benchGetInstance(benchmark::State& state)
+{
+    QuietOutput quiet;
+    Configuration* config = Configuration::getInstance();
+    for(auto _ : state)
+    {
+        benchmark::DoNotOptimize(Configuration::getInstance());
+    }
+    config->resetInstance();
+}
+BENCHMARK(benchGetInstance);
+
+static void benchAddConfig(benchmark::State& state)
+{
+    QuietOutput quiet;
+    Configuration* config = Configuration::getInstance();
+    for(auto _ : state)
+    {
+        config->addConfig("WindowSize", "25px");
+    }
+    config->resetInstance();
+}
+BENCHMARK(benchAddConfig);
+
+static void benchSnapshotLookup(benchmark::State& state)
+{
+    QuietOutput quiet;
+    Configuration* config = Configuration::getInstance();
+    config->addConfig("WindowSize", "25px");
+    for(auto _ : state)
+    {
+        std::shared_ptr<const ConfigSnapshot> values = config->snapshot();
+        benchmark::DoNotOptimize(values->find(std::string_view("WindowSize")));
+    }
+    config->resetInstance();
+}
+BENCHMARK(benchSnapshotLookup);
+
+// Baseline for the lookups below - the std::map the values used to be kept in.
+static void benchMapLookup(benchmark::State& state)
+{
+    std::map<std::string, std::string, std::less<>> values;
+    for(std::string_view key : KnownConfigKeys)
+    {
+        values.emplace(std::string(key), "25px");
+    }
+    for(auto _ : state)
+    {
+        benchmark::DoNotOptimize(values.find(std::string_view("WindowSize")));
+    }
+}
+BENCHMARK(benchMapLookup);
+
+// Known key through the perfect hash, and an unknown one through the fallback map.
+static void benchKnownKeyLookup(benchmark::State& state)
+{
+    ConfigSnapshot values;
+    for(std::string_view key : KnownConfigKeys)
+    {
+        values.insert(key, "25px");
+    }
+    std::string_view key = "WindowSize";
+    for(auto _ : state)
+    {
+        benchmark::DoNotOptimize(key);
+        benchmark::DoNotOptimize(values.find(key));
+    }
+}
+BENCHMARK(benchKnownKeyLookup);
+
+static void benchUnknownKeyLookup(benchmark::State& state)
+{
+    ConfigSnapshot values;
+    for(int i = 0; i < 8; ++i)
+    {
+        values.insert("Key" + std::to_string(i), "25px");
+    }
+    std::string_view key = "Key5";
+    for(auto _ : state)
+    {
+        benchmark::DoNotOptimize(key);
+        benchmark::DoNotOptimize(values.find(key));
+    }
+}
+BENCHMARK(benchUnknownKeyLookup);
+
+// Typed read through the singleton - the value was parsed when it was added, not here.
+static void benchTypedGet(benchmark::State& state)
+{
+    QuietOutput quiet;
+    Configuration* config = Configuration::getInstance();
+    config->addConfig("WindowSize", "25px");
+    for(auto _ : state)
+    {
+        benchmark::DoNotOptimize(config->get<int>("WindowSize"));
+    }
+    config->resetInstance();
+}
+BENCHMARK(benchTypedGet);
+
+// 32 reader threads look keys up while one writer keeps publishing batches of updates.
+// Every lookup is timed on its own, the counters are latency percentiles in nanoseconds over all readers.
+static void benchReadersWithWriter(benchmark::State& state)
+{
+    QuietOutput quiet;
+    const int readerCount = 32;
+    const int lookupsPerReader = 200000;
+    Configuration* config = Configuration::getInstance();
+    std::vector<std::pair<std::string, std::string>> initial;
+    for(int i = 0; i < 64; ++i)
+    {
+        initial.emplace_back("Key" + std::to_string(i), std::to_string(i));
+    }
+    config->addConfigs(initial);
+
+    for(auto _ : state)
+    {
+        std::atomic<bool> readersDone(false);
+        std::vector<std::vector<std::int64_t>> latencies(readerCount, std::vector<std::int64_t>(lookupsPerReader));
+        std::vector<std::thread> readers;
+        for(int reader = 0; reader < readerCount; ++reader)
+        {
+            readers.emplace_back([config, reader, &latencies]()
+            {
+                std::string key = "Key" + std::to_string(reader % 64);
+                for(int i = 0; i < lookupsPerReader; ++i)
+                {
+                    auto start = std::chrono::steady_clock::now();
+                    std::shared_ptr<const ConfigSnapshot> values = config->snapshot();
+                    benchmark::DoNotOptimize(values->find(key));
+                    auto stop = std::chrono::steady_clock::now();
+                    latencies[reader][i] = std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start).count();
+                }
+            });
+        }
+        std::thread writer([config, &readersDone]()
+        {
+            int round = 0;
+            while(!readersDone.load(std::memory_order_relaxed))
+            {
+                config->addConfigs({{"Update" + std::to_string(round % 16), std::to_string(round)}, {"WindowSize", "25px"}});
+                ++round;
+                std::this_thread::sleep_for(std::chrono::microseconds(100));
+            }
+        });
+        for(auto& reader : readers) { reader.join(); }
+        readersDone.store(true);
+        writer.join();
+
+        std::vector<std::int64_t> all;
+        all.reserve(static_cast<std::size_t>(readerCount) * lookupsPerReader);
+        for(const auto& readerLatencies : latencies)
+        {
+            all.insert(all.end(), readerLatencies.begin(), readerLatencies.end());
+        }
+        std::sort(all.begin(), all.end());
+        auto percentile = [&all](double p) { return static_cast<double>(all[static_cast<std::size_t>(p * (all.size() - 1))]); };
+        state.counters["p50_ns"] = percentile(0.50);
+        state.counters["p99_ns"] = percentile(0.99);
+        state.counters["p999_ns"] = percentile(0.999);
+        state.counters["max_ns"] = static_cast<double>(all.back());
+    }
+    config->resetInstance();
+}
+BENCHMARK(benchReadersWithWriter)->Iterations(1)->UseRealTime()->Unit(benchmark::kMillisecond);
+
+// Writes keyCount generated keys next to the known ones, through a rename so a watcher never sees half a file.
+static void writeConfigFile(const std::string& path, int keyCount, int round)
+{
+    std::string temporary = path + ".tmp";
+    {
+        std::ofstream file(temporary, std::ios::trunc);
+        file << "# generated by bench_singleton\nWindowSize = 25px\nRound = " << round << "\n";
+        for(int i = 0; i < keyCount; ++i)
+        {
+            file << "Key" << i << " = " << i + round << "\n";
+        }
+    }
+    std::rename(temporary.c_str(), path.c_str());
+}
+
+static std::string benchConfigPath()
+{
+    return (std::filesystem::temp_directory_path() / "bench_singleton.conf").string();
+}
+
+// Startup cost: mapping, parsing and publishing a config file with 100k keys.
+static void benchLoadFile(benchmark::State& state)
+{
+    QuietOutput quiet;
+    const int keyCount = 100000;
+    std::string path = benchConfigPath();
+    writeConfigFile(path, keyCount, 0);
+    Configuration* config = Configuration::getInstance();
+    for(auto _ : state)
+    {
+        benchmark::DoNotOptimize(config->loadFile(path));
+    }
+    state.counters["keys/s"] = benchmark::Counter(static_cast<double>(state.iterations()) * keyCount, benchmark::Counter::kIsRate);
+    config->resetInstance();
+    std::filesystem::remove(path);
+}
+BENCHMARK(benchLoadFile)->Unit(benchmark::kMillisecond);
+
+// Readers time every typed lookup while the 100k key file is watched. With the argument set, the file keeps being
+// replaced, so the watcher reloads it over and over - the percentiles should match the run without reloads.
+static void benchReadsDuringReload(benchmark::State& state)
+{
+    QuietOutput quiet;
+    const bool reloading = state.range(0) != 0;
+    const int readerCount = 4;
+    const int lookupsPerReader = 500000;
+    const int keyCount = 100000;
+    std::string path = benchConfigPath();
+    writeConfigFile(path, keyCount, 0);
+    Configuration* config = Configuration::getInstance();
+    config->watchFile(path, std::chrono::milliseconds(1));
+
+    for(auto _ : state)
+    {
+        std::atomic<bool> readersDone(false);
+        std::vector<std::vector<std::int64_t>> latencies(readerCount, std::vector<std::int64_t>(lookupsPerReader));
+        std::vector<std::thread> readers;
+        for(int reader = 0; reader < readerCount; ++reader)
+        {
+            readers.emplace_back([config, reader, &latencies]()
+            {
+                for(int i = 0; i < lookupsPerReader; ++i)
+                {
+                    auto start = std::chrono::steady_clock::now();
+                    benchmark::DoNotOptimize(config->get<int>("WindowSize"));
+                    auto stop = std::chrono::steady_clock::now();
+                    latencies[reader][i] = std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start).count();
+                }
+            });
+        }
+        int rewrites = 0;
+        std::thread rewriter([&]()
+        {
+            while(reloading && !readersDone.load(std::memory_order_relaxed))
+            {
+                writeConfigFile(path, keyCount, ++rewrites);
+                std::this_thread::sleep_for(std::chrono::milliseconds(20));
+            }
+        });
+        for(auto& reader : readers) { reader.join(); }
+        readersDone.store(true);
+        rewriter.join();
+
+        std::vector<std::int64_t> all;
+        all.reserve(static_cast<std::size_t>(readerCount) * lookupsPerReader);
+        for(const auto& readerLatencies : latencies)
+        {
+            all.insert(all.end(), readerLatencies.begin(), readerLatencies.end());
+        }
+        std::sort(all.begin(), all.end());
+        auto percentile = [&all](double p) { return static_cast<double>(all[static_cast<std::size_t>(p * (all.size() - 1))]); };
+        state.counters["p50_ns"] = percentile(0.50);
+        state.counters["p99_ns"] = percentile(0.99);
+        state.counters["p999_ns"] = percentile(0.999);
+        state.counters["max_ns"] = static_cast<double>(all.back());
+        state.counters["rewrites"] = rewrites;
+    }
+    config->stopWatching();
+    config->resetInstance();
+    std::filesystem::remove(path);
+}
+BENCHMARK(benchReadsDuringReload)->Arg(0)->Arg(1)->Iterations(1)->UseRealTime()->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
@@ -1,78 +1,21 @@
 /**
  * This is an example of the Singleton implementation. In such pattern the class can have only 1 instance of itself with global access point to it.
- * @note This is not a thread safe code.
+ * @note Creation, reads and writes are thread safe - readers work on immutable snapshots of the values.
+ * The values can also be loaded from a file and are reloaded while the application runs whenever the file changes.
  * @date 2023-09-17
  * 
  * @copyright Copyright (c) 2023
  * 
  */
-
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
 #include <iostream>
 #include <map>
-
-// An example of an application element that can be only one within the software.
-class Configuration
-{
-    private:
-    std::map<std::string, std::string> configValues_;
-    protected:
-    // Creation process
-    static Configuration* globalConfig_;
-    Configuration(std::pair<std::string, std::string> headerFields) : configValues_() { configValues_.insert(headerFields); }
-    public:
-    // Core Singleton functionality.
-    static Configuration* getInstance()
-    {
-        if(globalConfig_ == nullptr)
-        {
-            std::cout << "No config found. Creating new one." << std::endl;
-            globalConfig_ = new Configuration(std::make_pair("ConfigCreated", "true"));
-        }
-        else
-        {
-            std::cout << "Returning existing config" << std::endl;
-        }
-
-        return globalConfig_;
-    }
-
-    // Method related to function class
-    void addConfig(std::string field, std::string value)
-    {
-        if(globalConfig_ == nullptr)
-        {
-            std::cout << "Cannot add config! Configuration instance is null." << std::endl;
-            return;
-        }
-        
-        globalConfig_->configValues_.insert(std::make_pair(field, value));
-        std::cout << "Added " << field << " with value of " << value  << " to the config." << std::endl;
-    }
-
-    void show()
-    {
-        if(globalConfig_ == nullptr)
-        {
-            std::cout << "Cannot show config! Configuration instance is null." << std::endl;
-            return;
-        }
-
-        std::cout << "Format:" << std::endl;        
-        for(auto entry : globalConfig_->configValues_) 
-        { 
-            std::cout << entry.first << ": " << entry.second << std::endl;
-        }        
-    }
-
-    // Allows for destruction of singleton pointer
-    void resetInstance()
-    { 
-        delete globalConfig_;
-        globalConfig_ = nullptr;
-    }
-};
-
-Configuration* Configuration::globalConfig_ = nullptr;
+#include <string>
+#include <thread>
+#include "Singleton.h"
 
 void clientCode(Configuration* config)
 {
@@ -90,12 +33,45 @@ void clientCode(Configuration* config)
 
     // Check config
     config->show();
+
+    // Read a value already parsed into a number
+    std::cout << "Window size in pixels: " << config->get<int>("WindowSize").value_or(0) << std::endl;
+}
+
+// Replaces the file in one step, so the watcher never reads a half written one.
+void writeConfigFile(const std::string& path, const std::string& contents)
+{
+    std::string temporary = path + ".tmp";
+    std::ofstream(temporary, std::ios::trunc) << contents;
+    std::rename(temporary.c_str(), path.c_str());
+}
+
+void hotReloadClientCode(Configuration* config)
+{
+    std::string path = (std::filesystem::temp_directory_path() / "singleton_example.conf").string();
+    writeConfigFile(path, "# Application settings\nWindowSize = 30px\nTheme = dark\n");
+
+    // Load the file and keep watching it
+    config->watchFile(path, std::chrono::milliseconds(10));
+    config->show();
+
+    // Another process changes the file - the running application picks it up without a restart
+    writeConfigFile(path, "# Application settings\nWindowSize = 30px\nTheme = light\n");
+    for(int attempt = 0; attempt < 100 && config->getConfig("Theme") != "light"; ++attempt)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    config->show();
+
+    config->stopWatching();
+    std::filesystem::remove(path);
 }
 
 int main()
 {
     Configuration* mainAppConfig = Configuration::getInstance();
     clientCode(mainAppConfig);
+    hotReloadClientCode(mainAppConfig);
     mainAppConfig->resetInstance();
     return 0;
 }
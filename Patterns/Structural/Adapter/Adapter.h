@@ -0,0 +1,181 @@
+/**
+ * Classes of the Adapter example, shared by the demo (main.cpp) and its benchmark (bench.cpp).
+ * The pattern itself is described in the header of main.cpp.
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ */
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <vector>
+#include <time.h>
+#include "GenericAdapter.h"
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+// This is just a concrete class not related to the adapter design pattern. You could do it without it.
+class Plug
+{
+    public: 
+    int boltCount_;
+    Plug() : boltCount_(2) {}
+};
+
+// One bit per plug of a batch, set if the plug fits.
+class FitMask
+{
+    private:
+    std::vector<std::uint64_t> words_;
+    std::size_t size_;
+    public:
+    explicit FitMask(std::size_t size = 0) : words_((size + 63) / 64, 0), size_(size) {}
+    bool fits(std::size_t index) const { return (words_[index / 64] >> (index % 64)) & 1; }
+    std::size_t fitting() const
+    {
+        std::size_t count = 0;
+        for(std::uint64_t word : words_)
+        {
+            count += std::bitset<64>(word).count();
+        }
+        return count;
+    }
+    std::size_t size() const { return size_; }
+    std::uint64_t* words() { return words_.data(); }
+};
+
+// Target
+class EuropeanSocket
+{
+    public:
+    virtual ~EuropeanSocket() {}
+    virtual void plugIn(Plug* p)
+    {
+        std::cout << "Plugged successfully." << std::endl; 
+    }
+};
+
+// Adaptee
+class BritishSocket
+{
+    public:
+    bool fits(const Plug* eS) const
+    {
+        return eS->boltCount_ == 3;
+    }
+    void plugIn(Plug* eS)
+    {
+        !fits(eS) ? std::cout << "Your plug does not fit into the British socket!" << std::endl : std::cout << "Plugged successfully." << std::endl;
+    }
+
+    // Fit check of a whole array at once - plugs points to count plugs, and bit i of the words is set if plugs[i] fits.
+    // The words must hold count bits.
+    /// @note count has to be a multiple of 64, except for the last call of a batch.
+    void fitMask(const Plug* plugs, std::size_t count, std::uint64_t* words) const
+    {
+        for(std::size_t i = 0; i < count; i += 64)
+        {
+            // The bolt counts of the block are gathered first, so the compares run over a real int array
+            std::size_t lanes = std::min<std::size_t>(64, count - i);
+            std::array<int, 64> boltCounts;
+            for(std::size_t lane = 0; lane < lanes; ++lane)
+            {
+                boltCounts[lane] = plugs[i + lane].boltCount_;
+            }
+            std::uint64_t word = 0;
+            std::size_t lane = 0;
+#if defined(__SSE2__)
+            // 4 plugs per compare
+            const __m128i britishBolts = _mm_set1_epi32(3);
+            for(; lane + 4 <= lanes; lane += 4)
+            {
+                __m128i bolts = _mm_loadu_si128(reinterpret_cast<const __m128i*>(boltCounts.data() + lane));
+                std::uint64_t bits = static_cast<std::uint64_t>(_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(bolts, britishBolts))));
+                word |= bits << lane;
+            }
+#endif
+            for(; lane < lanes; ++lane)
+            {
+                word |= static_cast<std::uint64_t>(boltCounts[lane] == 3) << lane;
+            }
+            words[i / 64] = word;
+        }
+    }
+};
+
+// Adapter
+class SocketAdapter : public EuropeanSocket
+{
+    private:
+    BritishSocket* socketAdaptee_;
+    public:
+    SocketAdapter(BritishSocket* adaptee) : socketAdaptee_(adaptee) {} 
+    void plugIn(Plug* p)
+    {
+        // Tmp store value of the bolts count
+        int tmpBoltCount = p->boltCount_;
+        // Insert a adapter onto socket and increase the bolt count
+        ++p->boltCount_;
+        // Insert
+        socketAdaptee_->plugIn(p);
+        // Remove adapter after working
+        p->boltCount_ = tmpBoltCount;
+    }
+
+    // Plugs in a whole array. The plugs are adapted in chunks copied to the stack, the array itself is left untouched,
+    // and nothing is printed - the result is one fit bit per plug.
+    FitMask plugInAll(const Plug* plugs, std::size_t count)
+    {
+        const std::size_t chunkSize = 256;
+        std::array<Plug, chunkSize> adapted;
+        FitMask mask(count);
+        for(std::size_t first = 0; first < count; first += chunkSize)
+        {
+            std::size_t chunk = std::min(chunkSize, count - first);
+            for(std::size_t i = 0; i < chunk; ++i)
+            {
+                adapted[i].boltCount_ = plugs[first + i].boltCount_ + 1;
+            }
+            socketAdaptee_->fitMask(adapted.data(), chunk, mask.words() + first / 64);
+        }
+        return mask;
+    }
+    FitMask plugInAll(const std::vector<Plug>& plugs)
+    { return plugInAll(plugs.data(), plugs.size()); }
+};
+
+// Transforms for the generic adapter (GenericAdapter.h). Both hand the british socket an adapted copy of the plug.
+struct AddBritishBolt
+{
+    void operator()(BritishSocket& socket, const Plug* p) const
+    {
+        Plug adapted(*p);
+        ++adapted.boltCount_;
+        socket.plugIn(&adapted);
+    }
+};
+
+struct CheckBritishFit
+{
+    bool operator()(const BritishSocket& socket, const Plug* p) const
+    {
+        Plug adapted(*p);
+        ++adapted.boltCount_;
+        return socket.fits(&adapted);
+    }
+};
+
+// Same adapter as SocketAdapter, but built on the generic one - the plug is only read, never changed and restored.
+class GenericSocketAdapter final : public Adapter<EuropeanSocket, BritishSocket, AddBritishBolt>
+{
+    public:
+    using Adapter::Adapter;
+    void plugIn(Plug* p) override
+    { adapt(p); }
+};
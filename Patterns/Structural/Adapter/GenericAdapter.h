@@ -0,0 +1,31 @@
+/**
+ * Generic adapter. It is a Target, holds the Adaptee and leaves the actual adaptation to Transform - a callable that
+ * gets the adaptee and the arguments of the target side call, and calls the adaptee with converted values of its own.
+ * The input of the caller is never written to, so one input can be used by any number of threads at once.
+ * Called on the adapter type itself (adapt), the whole adaptation is a direct call the compiler can inline.
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ */
+#pragma once
+
+#include <utility>
+
+template<typename Target, typename Adaptee, typename Transform>
+class Adapter : public Target
+{
+    private:
+    Adaptee* adaptee_;
+    Transform transform_;
+
+    public:
+    explicit Adapter(Adaptee* adaptee, Transform transform = Transform()) : adaptee_(adaptee), transform_(transform) {}
+
+    template<typename... Args>
+    decltype(auto) adapt(Args&&... args) const
+    {
+        return transform_(*adaptee_, std::forward<Args>(args)...);
+    }
+
+    Adaptee* adaptee() const { return adaptee_; }
+};
@@ -0,0 +1,73 @@
+/**
+ * Classes of the multiple inheritance Adapter example, shared by the demo (main.cpp) and its benchmark (bench.cpp).
+ * The pattern itself is described in the header of main.cpp.
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ */
+#pragma once
+
+#include <iostream>
+#include "../GenericAdapter.h"
+
+// This is just a concrete class not related to the adapter design pattern. You could do it without it.
+class Plug
+{
+    public: 
+    int boltCount_;
+    Plug() : boltCount_(2) {}
+};
+
+// Target
+class EuropeanSocket
+{
+    public:
+    virtual ~EuropeanSocket() {}
+    virtual void plugIn(Plug* p)
+    {
+        std::cout << "Plugged successfully." << std::endl; 
+    }
+};
+
+// Adaptee
+class BritishSocket
+{
+    public:
+    void plugInBritish(Plug* eS)
+    {
+        eS->boltCount_ != 3 ? std::cout << "Your plug does not fit into the British socket!" << std::endl : std::cout << "Plugged successfully." << std::endl;
+    }
+};
+
+class SocketAdapter : public BritishSocket, public EuropeanSocket
+{
+    public:
+    SocketAdapter() {}
+    void plugIn(Plug* p) override
+    {
+        int tmpBoltCount = p->boltCount_;
+        p->boltCount_ = 3;
+        plugInBritish(p);
+        p->boltCount_ = tmpBoltCount;
+    }
+};
+
+// The generic adapter for the same sockets, giving the british socket a copy with 3 bolts instead of changing the plug.
+struct UseBritishBolts
+{
+    void operator()(BritishSocket& socket, const Plug* p) const
+    {
+        Plug adapted(*p);
+        adapted.boltCount_ = 3;
+        socket.plugInBritish(&adapted);
+    }
+};
+
+// Same job as SocketAdapter, but holding the socket instead of inheriting it - the plug is only read, never changed.
+class GenericSocketAdapter final : public Adapter<EuropeanSocket, BritishSocket, UseBritishBolts>
+{
+    public:
+    using Adapter::Adapter;
+    void plugIn(Plug* p) override
+    { adapt(p); }
+};
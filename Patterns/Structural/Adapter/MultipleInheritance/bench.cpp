@@ -0,0 +1,78 @@
+// Benchmarks of the multiple inheritance Adapter hot call, against the generic adapter over the same sockets.
+// One plug shared by many threads shows that the adapter changing the plug is not safe to share.
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <optional>
+#include "AdapterMultipleInheritance.h"
+#include "QuietOutput.h"
+
+static void benchSocketAdapter(benchmark::State& state)
+{
+    QuietOutput quiet;
+    Plug plug;
+    SocketAdapter adapter;
+    EuropeanSocket* socket = &adapter;
+    for(auto _ : state)
+    {
+        socket->plugIn(&plug);
+    }
+}
+BENCHMARK(benchSocketAdapter);
+
+static void benchGenericAdapter(benchmark::State& state)
+{
+    QuietOutput quiet;
+    Plug plug;
+    BritishSocket adaptee;
+    GenericSocketAdapter adapter(&adaptee);
+    EuropeanSocket* socket = &adapter;
+    for(auto _ : state)
+    {
+        socket->plugIn(&plug);
+    }
+}
+BENCHMARK(benchGenericAdapter);
+
+static void benchGenericAdapterStatic(benchmark::State& state)
+{
+    QuietOutput quiet;
+    Plug plug;
+    BritishSocket adaptee;
+    GenericSocketAdapter adapter(&adaptee);
+    for(auto _ : state)
+    {
+        adapter.adapt(&plug);
+    }
+}
+BENCHMARK(benchGenericAdapterStatic);
+
+// Every thread plugs in the same plug. SocketAdapter sets the plug to 3 bolts and puts the old count back, and a count
+// taken while another thread had set it is 3 - from 2 threads on the plug ends up changed for good, changed_plugs
+// goes above 0. Misfits (the "does not fit" messages of the british socket) only show up when a thread puts 2 bolts
+// back between another one's set and check, so they mostly stay 0. Both are reported, not checked.
+static Plug sharedPlug;
+
+static void benchSharedPlugRace(benchmark::State& state)
+{
+    // Thread 0 sets up for all of them - the loop starts and ends on a barrier of all threads
+    std::optional<CountedOutput> output;
+    if(state.thread_index() == 0)
+    {
+        sharedPlug = Plug();
+        output.emplace("Your plug does not fit");
+    }
+    SocketAdapter adapter;
+    EuropeanSocket* socket = &adapter;
+    std::size_t changedPlugs = 0;
+    for(auto _ : state)
+    {
+        socket->plugIn(&sharedPlug);
+        benchmark::ClobberMemory();
+        changedPlugs += sharedPlug.boltCount_ == 2 ? 0 : 1;
+    }
+    state.counters["misfits"] = output ? static_cast<double>(output->count()) : 0.0;
+    state.counters["changed_plugs"] = static_cast<double>(changedPlugs);
+}
+BENCHMARK(benchSharedPlugRace)->Threads(1)->Threads(8)->Threads(32)->UseRealTime();
+
+BENCHMARK_MAIN();
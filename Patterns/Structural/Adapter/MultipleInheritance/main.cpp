@@ -1,47 +1,6 @@
 // C++ allows multiple inheritance thus it can make the program less complex
 #include <iostream>
-
-// This is just a concrete class not related to the adapter design pattern. You could do it without it.
-class Plug
-{
-    public: 
-    int boltCount_;
-    Plug() : boltCount_(2) {}
-};
-
-// Target
-class EuropeanSocket
-{
-    public:
-    virtual ~EuropeanSocket() {}
-    virtual void plugIn(Plug* p)
-    {
-        std::cout << "Plugged successfully." << std::endl; 
-    }
-};
-
-// Adaptee
-class BritishSocket
-{
-    public:
-    void plugInBritish(Plug* eS)
-    {
-        eS->boltCount_ != 3 ? std::cout << "Your plug does not fit into the British socket!" << std::endl : std::cout << "Plugged successfully." << std::endl;
-    }
-};
-
-class SocketAdapter : public BritishSocket, public EuropeanSocket
-{
-    public:
-    SocketAdapter() {}
-    void plugIn(Plug* p) override
-    {
-        int tmpBoltCount = p->boltCount_;
-        p->boltCount_ = 3;
-        plugInBritish(p);
-        p->boltCount_ = tmpBoltCount;
-    }
-};
+#include "AdapterMultipleInheritance.h"
 
 void clientCode(EuropeanSocket* targetSocket, Plug* p)
 {
@@ -67,10 +26,14 @@ int main()
     SocketAdapter* sA = new SocketAdapter;
     clientCode(sA, euroPlug);
 
+    std::cout << "Now I will use the generic adapter, which leaves my plug as it is." << std::endl;
+    GenericSocketAdapter* gA = new GenericSocketAdapter(britSock);
+    clientCode(gA, euroPlug);
 
     delete euroPlug;
     delete euroSock;
     delete britSock;
     delete sA;
+    delete gA;
     return 0;
 }
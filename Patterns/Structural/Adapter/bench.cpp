@@ -0,0 +1,177 @@
+// Benchmarks of the Adapter hot call: plugging a european plug in through the socket adapter, the generic one,
+// and a whole array of plugs at once. One plug shared by many threads shows which of the adapters can take it.
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <optional>
+#include <vector>
+#include "Adapter.h"
+#include "QuietOutput.h"
+
+static void benchAdaptee(benchmark::State& state)
+{
+    QuietOutput quiet;
+    Plug plug;
+    BritishSocket socket;
+    for(auto _ : state)
+    {
+        socket.plugIn(&plug);
+    }
+}
+BENCHMARK(benchAdaptee);
+
+static void benchSocketAdapter(benchmark::State& state)
+{
+    QuietOutput quiet;
+    Plug plug;
+    BritishSocket adaptee;
+    SocketAdapter adapter(&adaptee);
+    EuropeanSocket* socket = &adapter;
+    for(auto _ : state)
+    {
+        socket->plugIn(&plug);
+    }
+}
+BENCHMARK(benchSocketAdapter);
+
+static void benchGenericAdapter(benchmark::State& state)
+{
+    QuietOutput quiet;
+    Plug plug;
+    BritishSocket adaptee;
+    GenericSocketAdapter adapter(&adaptee);
+    EuropeanSocket* socket = &adapter;
+    for(auto _ : state)
+    {
+        socket->plugIn(&plug);
+    }
+}
+BENCHMARK(benchGenericAdapter);
+
+// Adapter type known statically - no virtual call left.
+static void benchGenericAdapterStatic(benchmark::State& state)
+{
+    QuietOutput quiet;
+    Plug plug;
+    BritishSocket adaptee;
+    GenericSocketAdapter adapter(&adaptee);
+    for(auto _ : state)
+    {
+        adapter.adapt(&plug);
+    }
+}
+BENCHMARK(benchGenericAdapterStatic);
+
+// Without the printing, the adaptation itself is down to a compare.
+static void benchGenericFitCheck(benchmark::State& state)
+{
+    Plug plug;
+    BritishSocket adaptee;
+    Adapter<EuropeanSocket, BritishSocket, CheckBritishFit> adapter(&adaptee);
+    for(auto _ : state)
+    {
+        benchmark::DoNotOptimize(&plug);
+        benchmark::DoNotOptimize(adapter.adapt(&plug));
+    }
+}
+BENCHMARK(benchGenericFitCheck);
+
+// Stress run - every thread adapts the same plug and checks that it fits, while the plug must keep its 2 bolts.
+// Both counters are summed over the threads and have to stay 0, the run fails otherwise.
+static Plug sharedPlug;
+static BritishSocket sharedSocket;
+
+static void benchSharedPlugStress(benchmark::State& state)
+{
+    Adapter<EuropeanSocket, BritishSocket, CheckBritishFit> adapter(&sharedSocket);
+    std::size_t misfits = 0;
+    std::size_t changedPlugs = 0;
+    for(auto _ : state)
+    {
+        benchmark::ClobberMemory();   // Read the shared plug again on every pass
+        misfits += adapter.adapt(&sharedPlug) ? 0 : 1;
+        changedPlugs += sharedPlug.boltCount_ == 2 ? 0 : 1;
+    }
+    state.counters["misfits"] = static_cast<double>(misfits);
+    state.counters["changed_plugs"] = static_cast<double>(changedPlugs);
+    if(misfits != 0 || changedPlugs != 0)
+    {
+        state.SkipWithError("The generic adapter changed the shared plug");
+    }
+}
+BENCHMARK(benchSharedPlugStress)->Threads(1)->Threads(8)->Threads(32)->UseRealTime();
+
+// The same run through SocketAdapter, which adds a bolt to the plug itself and puts the old count back. The threads
+// add bolts on top of each other's and put back counts taken mid adaptation, so from 2 threads on the plug ends up
+// changed for good and both counters go above 0 - they are reported, not checked.
+// Misfits are the "does not fit" messages of the british socket.
+static Plug racedPlug;
+
+static void benchSharedPlugRace(benchmark::State& state)
+{
+    // Thread 0 sets up for all of them - the loop starts and ends on a barrier of all threads
+    std::optional<CountedOutput> output;
+    if(state.thread_index() == 0)
+    {
+        racedPlug = Plug();
+        output.emplace("Your plug does not fit");
+    }
+    SocketAdapter adapter(&sharedSocket);
+    EuropeanSocket* socket = &adapter;
+    std::size_t changedPlugs = 0;
+    for(auto _ : state)
+    {
+        socket->plugIn(&racedPlug);
+        benchmark::ClobberMemory();
+        changedPlugs += racedPlug.boltCount_ == 2 ? 0 : 1;
+    }
+    state.counters["misfits"] = output ? static_cast<double>(output->count()) : 0.0;
+    state.counters["changed_plugs"] = static_cast<double>(changedPlugs);
+}
+BENCHMARK(benchSharedPlugRace)->Threads(1)->Threads(8)->Threads(32)->UseRealTime();
+
+// 10M plugs, every 7th one already british. Per object through plugIn, against one plugInAll over the array.
+static const std::size_t plugCount = 10000000;
+
+static std::vector<Plug> makePlugs()
+{
+    std::vector<Plug> plugs(plugCount);
+    for(std::size_t i = 0; i < plugCount; i += 7)
+    {
+        plugs[i].boltCount_ = 3;
+    }
+    return plugs;
+}
+
+static void benchPlugInEach(benchmark::State& state)
+{
+    QuietOutput quiet;
+    std::vector<Plug> plugs = makePlugs();
+    BritishSocket adaptee;
+    SocketAdapter adapter(&adaptee);
+    EuropeanSocket* socket = &adapter;
+    for(auto _ : state)
+    {
+        for(Plug& plug : plugs)
+        {
+            socket->plugIn(&plug);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * plugCount);
+}
+BENCHMARK(benchPlugInEach)->Unit(benchmark::kMillisecond);
+
+static void benchPlugInAll(benchmark::State& state)
+{
+    std::vector<Plug> plugs = makePlugs();
+    BritishSocket adaptee;
+    SocketAdapter adapter(&adaptee);
+    for(auto _ : state)
+    {
+        FitMask fit = adapter.plugInAll(plugs);
+        benchmark::DoNotOptimize(fit.words());
+    }
+    state.SetItemsProcessed(state.iterations() * plugCount);
+}
+BENCHMARK(benchPlugInAll)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
@@ -6,56 +6,9 @@
  * 
  */
 #include <iostream>
+#include <vector>
 #include <time.h>
-
-// This is just a concrete class not related to the adapter design pattern. You could do it without it.
-class Plug
-{
-    public: 
-    int boltCount_;
-    Plug() : boltCount_(2) {}
-};
-
-// Target
-class EuropeanSocket
-{
-    public:
-    virtual ~EuropeanSocket() {}
-    virtual void plugIn(Plug* p)
-    {
-        std::cout << "Plugged successfully." << std::endl; 
-    }
-};
-
-// Adaptee
-class BritishSocket
-{
-    public:
-    void plugIn(Plug* eS)
-    {
-        eS->boltCount_ != 3 ? std::cout << "Your plug does not fit into the British socket!" << std::endl : std::cout << "Plugged successfully." << std::endl;
-    }
-};
-
-// Adapter
-class SocketAdapter : public EuropeanSocket
-{
-    private:
-    BritishSocket* socketAdaptee_;
-    public:
-    SocketAdapter(BritishSocket* adaptee) : socketAdaptee_(adaptee) {} 
-    void plugIn(Plug* p)
-    {
-        // Tmp store value of the bolts count
-        int tmpBoltCount = p->boltCount_;
-        // Insert a adapter onto socket and increase the bolt count
-        ++p->boltCount_;
-        // Insert
-        socketAdaptee_->plugIn(p);
-        // Remove adapter after working
-        p->boltCount_ = tmpBoltCount;
-    }
-};
+#include "Adapter.h"
 
 void clientCode(EuropeanSocket* socket, Plug* plug)
 {
@@ -78,9 +31,20 @@ int main()
     SocketAdapter* sA = new SocketAdapter(britSock);
     clientCode(sA, euroPlug);
 
+    std::cout << "Now I will use the generic adapter, which leaves my plug as it is." << std::endl;
+    GenericSocketAdapter* gA = new GenericSocketAdapter(britSock);
+    clientCode(gA, euroPlug);
+
+    std::cout << "Now I will plug a whole box of european plugs into the british socket through the adapter at once." << std::endl;
+    std::vector<Plug> plugBox(8);
+    plugBox[5].boltCount_ = 3; // A british plug got into the box by mistake
+    FitMask fit = sA->plugInAll(plugBox);
+    std::cout << fit.fitting() << " of " << fit.size() << " plugs fit." << std::endl;
+
     delete euroPlug;
     delete euroSock;
     delete britSock;
     delete sA;
+    delete gA;
     return 0;
 }
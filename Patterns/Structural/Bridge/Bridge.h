@@ -0,0 +1,333 @@
+/**
+ * Classes of the Bridge example, shared by the demo (main.cpp) and its benchmark (bench.cpp).
+ * The pattern itself is described in the header of main.cpp.
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ */
+#pragma once
+
+#include <iostream>
+#include <ostream>
+#include <string>
+
+enum weapon
+{
+    bow = 0,
+    oneHandSword,
+    twoHandSword,
+    staff
+};
+
+// Stream the enemies talk to. It is std::cout, unless a thread silences them (CombatSimulation.h).
+inline std::ostream*& enemyLogTarget()
+{
+    thread_local std::ostream* target = &std::cout;
+    return target;
+}
+inline std::ostream& enemyLog() { return *enemyLogTarget(); }
+
+// Abstract implementation - interface
+class EnemyClass
+{
+    protected:
+    std::string name_;
+    int health_;
+    int baseStat_;
+    weapon heldWeapon_;
+    bool alive_;
+    public:
+    EnemyClass(std::string name, weapon weapon) : name_(name), health_(100), baseStat_(10), heldWeapon_(weapon), alive_(true) {} 
+    virtual void setName(std::string newName)           = 0;
+    virtual std::string getName()                       = 0;
+    virtual bool isAlive()                              = 0;
+    virtual void setAlive(bool newStatus)               = 0;
+    virtual void setHealth(int health)                  = 0;
+    virtual int getHealth()                             = 0;
+    virtual void setWeapon(weapon newWeapon)            = 0;
+    virtual weapon getWeapon()                          = 0;
+    virtual void setBaseStat(int newStat)               = 0;
+    virtual int getBaseStat()                           = 0;
+    virtual void makeAttack()                           = 0;
+    virtual void makeUltimateAttack()                   = 0;
+    virtual void blockAttack()                          = 0;
+    virtual int blockedDamage(int damage)               = 0;    // What is left of an attack after blockAttack
+    virtual void chargeEnemy(std::string enemyToCharge) = 0;
+    virtual void postDeathRambling()                    = 0;
+    virtual void preDeathRambling()                     = 0;
+    virtual ~EnemyClass() {};
+};
+
+// Concrete implementation
+class EnemyClassWarrior final : public EnemyClass
+{
+    public:
+    EnemyClassWarrior(std::string name) : EnemyClass(name, oneHandSword) {}
+    void setName(std::string newName) override
+    { this->name_ = newName; }
+    std::string getName() override
+    { return this->name_; }
+    bool isAlive() override { return alive_; }
+    void setAlive(bool newStatus) override { this->alive_ = newStatus; }
+    void setHealth(int health) override  
+    { 
+        this->health_ = health;
+        if(this->health_ == 0)
+        {
+            this->alive_ = false;
+        }
+    }
+    int getHealth() override
+    { return health_;}
+    weapon getWeapon() override 
+    { return heldWeapon_; }
+    void setWeapon(weapon newWeapon) override 
+    { 
+        if(newWeapon != oneHandSword || newWeapon != twoHandSword)
+        {
+            enemyLog() << "A warrior shall not use anything exept swords!" << std::endl;
+            return;
+        }
+
+        this->heldWeapon_ = newWeapon;
+    }
+    int getBaseStat() override
+    { return this->baseStat_; }
+    void setBaseStat(int newStat) override
+    { this->baseStat_ = newStat; }
+    void makeAttack() override
+    {
+        enemyLog() << "A warrior tries to slash you with his sword!" << std::endl;
+    }
+    void makeUltimateAttack() override
+    {
+        enemyLog() << "A warrior makes his way to try to behead you with his sword doing some sick sword dance" << std::endl;
+    }
+    void blockAttack() override
+    {
+        if(this->heldWeapon_ == twoHandSword)
+        {
+            enemyLog() << "The warrior is trying to use his sword to block your attack (not very effective!)" << std::endl;
+        }
+        else if(this->heldWeapon_ == oneHandSword)
+        {
+            enemyLog() << "The warrior is using the shiled to block your attack (effective!)" << std::endl;
+        }
+        else
+        {
+            enemyLog() << "The warrior scratches his head because he don't know how to use his weapon in a mean of defence (he gets hit)" << std::endl;
+        }
+    }
+    int blockedDamage(int damage) override
+    {
+        if(this->heldWeapon_ == twoHandSword) { return damage * 3 / 4; }
+        if(this->heldWeapon_ == oneHandSword) { return damage / 4; }
+        return damage;
+    }
+    void chargeEnemy(std::string enemyToCharge) override
+    {
+        enemyLog() << "The warrior is rushing straight towards you screamin!" << std::endl;
+    }
+    void postDeathRambling() override
+    {
+        enemyLog() << "I, " << this->name_ << " shalln't kneel before you!!" << std::endl;
+        enemyLog() << "*Dies*" << std::endl;
+    }
+    void preDeathRambling() override
+    {
+        enemyLog() << "You thought you can kill ME?" << std::endl;
+        enemyLog() << "*enters phase 2*" << std::endl;
+    }
+};
+
+// concrete implementation
+class EnemyClassMage final : public EnemyClass
+{
+    public:
+    EnemyClassMage(std::string name) : EnemyClass(name, staff) {}
+    void setName(std::string newName) override
+    { this->name_ = newName; }
+    std::string getName() override
+    { return this->name_; }
+    bool isAlive() override { return alive_; }
+    void setAlive(bool newStatus) override { this->alive_ = newStatus; }
+    void setHealth(int health) override  
+    { 
+        this->health_ = health;
+        if(this->health_ == 0)
+        {
+            this->alive_ = false;
+        }
+    }
+    int getHealth() override
+    { return health_;}
+    weapon getWeapon() override 
+    { return heldWeapon_; }
+    void setWeapon(weapon newWeapon) override 
+    { 
+        if(newWeapon == twoHandSword)
+        {
+            enemyLog() << "A mage codex forbids them from using two handed swords" << std::endl;
+            return;
+        }
+
+        this->heldWeapon_ = newWeapon;
+    }
+    int getBaseStat() override
+    { return this->baseStat_; }
+    void setBaseStat(int newStat) override
+    { this->baseStat_ = newStat; }
+    void makeAttack() override
+    {
+        enemyLog() << "The mage is using his stuff in order to cast a deadly spell!" << std::endl;
+    }
+    void makeUltimateAttack() override
+    {
+        enemyLog() << "The mage is shooting at you with a great fireball with a power of a nuclear warhead!" << std::endl;
+    }
+    void blockAttack() override
+    {
+        if(this->heldWeapon_ == twoHandSword)
+        {
+            enemyLog() << "The mage surrenders and accepts his fate as he broken the sacred law." << std::endl;
+        }
+        else
+        {
+            enemyLog() << "The mage is casting a defensive spell, which addapts to your means of weaponry! (super effective!!!)" << std::endl;
+        }
+    }
+    int blockedDamage(int damage) override
+    { return this->heldWeapon_ == twoHandSword ? damage : 0; }
+    void chargeEnemy(std::string enemyToCharge) 
+    {
+        enemyLog() << "The mage put out his scroll while looking at you, ready to make a move." << std::endl;
+    }
+    void postDeathRambling() override
+    {
+        enemyLog() << "Starts talking about the life and death and the importance of it, also trying to get your zodiac sign before death(weird)." << std::endl;
+        enemyLog() << "*Dies*" << std::endl;
+    }
+    void preDeathRambling() override
+    {
+        enemyLog() << "You're a smart and shrewd boy, but enough is enough." << std::endl;
+        enemyLog() << "*enters phase 2*" << std::endl;
+    }
+};
+
+// The actions of the abstraction, written once for any implementation - Enemy calls them on an EnemyClass, the flavors
+// of StaticBridge.h on a concrete class, so every flavor does the very same work.
+namespace EnemyActions
+{
+    template<typename Unit>
+    void kill(Unit& unit)
+    {
+        if(unit.isAlive())
+        {
+            enemyLog() << "A Godly force has cursed " << unit.getName()  << ", and thus it dies." << std::endl;
+            unit.setHealth(0);
+        }
+    }
+    template<typename Unit>
+    void ressurect(Unit& unit)
+    {
+        if(!unit.isAlive())
+        {
+            enemyLog() << "A Godly force has ressurected the fallen unit! " << unit.getName() << " is back alive!" << std::endl;
+            unit.setAlive(true);
+            unit.setHealth(100);
+        }
+    }
+    template<typename Unit>
+    void changeWeapon(Unit& unit, weapon newWeapon)
+    {
+        enemyLog() << "Log: Changed " << unit.getName() << " to " << newWeapon << std::endl;
+        unit.setWeapon(newWeapon);
+    }
+    template<typename Unit>
+    void forceAttack(Unit& unit, const std::string& target)
+    {
+        unit.chargeEnemy(target);
+        unit.makeAttack();
+    }
+    template<typename Unit>
+    void hit(Unit& unit, int hitPower)
+    { unit.setHealth(unit.getHealth() - hitPower); }
+    template<typename Unit>
+    void heal(Unit& unit, int healPower)
+    { unit.setHealth(unit.getHealth() + healPower); }
+    template<typename Unit>
+    void makeStronger(Unit& unit)
+    { unit.setBaseStat(unit.getBaseStat() + 1); }
+    template<typename Unit>
+    void makeWeaker(Unit& unit)
+    { unit.setBaseStat(unit.getBaseStat() - 1); }
+    template<typename Unit>
+    void block(Unit& unit)
+    { unit.blockAttack(); }
+}
+
+// Abstraction
+class Enemy
+{
+    protected:
+    EnemyClass* unit_;
+    public:
+    Enemy(EnemyClass* startingClass) : unit_(startingClass) {}
+    virtual void kill()
+    { EnemyActions::kill(*unit_); }
+    virtual void ressurect()
+    { EnemyActions::ressurect(*unit_); }
+    virtual void changeWeapon(weapon newWeapon)
+    { EnemyActions::changeWeapon(*unit_, newWeapon); }
+
+    virtual void forceAttack(std::string target)
+    { EnemyActions::forceAttack(*unit_, target); }
+    // Hit as hit the selected unit
+    virtual void hit(int hitPower)
+    { EnemyActions::hit(*unit_, hitPower); }
+
+    virtual void heal(int healPower)
+    { EnemyActions::heal(*unit_, healPower); }
+    virtual void makeStronger()
+    { EnemyActions::makeStronger(*unit_); }
+    virtual void makeWeaker()
+    { EnemyActions::makeWeaker(*unit_); }
+    virtual void block()
+    { EnemyActions::block(*unit_); }
+    virtual ~Enemy() {}
+};
+
+// Extended abstraction
+class EnemyBoss : public Enemy
+{
+    public:
+    EnemyBoss(EnemyClass* bossClass) : Enemy(bossClass) {} 
+    void ressurect() override
+    {
+        if(!unit_->isAlive())
+        {
+            unit_->preDeathRambling();
+            unit_->setAlive(true);
+            unit_->setHealth(100);
+        }
+    }
+    void kill() override
+    {
+        if(unit_->isAlive())
+        {
+            unit_->postDeathRambling();
+            unit_->setHealth(unit_->getHealth() - unit_->getHealth());
+        }
+    }
+    void block() override
+    { 
+        unit_->blockAttack();
+        attackChain();
+    }
+    virtual void attackChain()
+    {
+        unit_->makeAttack();
+        unit_->makeAttack();
+        unit_->makeUltimateAttack();
+    }
+};
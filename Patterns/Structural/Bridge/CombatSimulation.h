@@ -0,0 +1,223 @@
+/**
+ * Tick based combat of many enemies against the player, advanced in parallel on a WorkStealingPool.
+ * Every tick each living enemy gets one command - forceAttack, block or (bosses only) attackChain - and the player
+ * hits all of them with an area attack. Commands and hit powers come from a hash of (seed, tick, enemy index) instead
+ * of a shared random generator, and an enemy only ever changes its own state, so the outcome of a seed is the same
+ * whatever the number of threads and however the chunks were stolen.
+ * The commands are the methods of Enemy and EnemyBoss, called on the real abstraction. Each enemy's implementation is
+ * wrapped in a CombatUnit, which scores the attacks those methods make, and the enemies are silenced (enemyLog) while
+ * the simulation runs - thousands of them would do nothing but talk.
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ */
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+#include "Bridge.h"
+#include "WorkStealingPool.h"
+
+enum class CombatCommand
+{
+    ForceAttack = 0,
+    Block,
+    AttackChain
+};
+
+// State of the whole fight after some ticks, equal for equal seeds.
+struct CombatOutcome
+{
+    std::uint64_t ticks;
+    std::size_t alive;
+    std::uint64_t damageToPlayer;
+    std::uint64_t checksum;     // Hash of the health of every enemy, in index order
+
+    bool operator==(const CombatOutcome& other) const
+    {
+        return ticks == other.ticks && alive == other.alive && damageToPlayer == other.damageToPlayer && checksum == other.checksum;
+    }
+    bool operator!=(const CombatOutcome& other) const { return !(*this == other); }
+};
+
+// Implementation the Enemy of a combatant is bridged to. Every call goes on to the real unit, and the attacks and blocks
+// made through it are scored: an attack deals the base stat, an ultimate attack three times as much.
+class CombatUnit final : public EnemyClass
+{
+    private:
+    std::unique_ptr<EnemyClass> unit_;
+    int damageDealt_;
+    bool blocked_;
+    public:
+    explicit CombatUnit(EnemyClass* unit) : EnemyClass(std::string(), bow), unit_(unit), damageDealt_(0), blocked_(false) {}
+    void setName(std::string newName) override { unit_->setName(std::move(newName)); }
+    std::string getName() override { return unit_->getName(); }
+    bool isAlive() override { return unit_->isAlive(); }
+    void setAlive(bool newStatus) override { unit_->setAlive(newStatus); }
+    void setHealth(int health) override { unit_->setHealth(health); }
+    int getHealth() override { return unit_->getHealth(); }
+    void setWeapon(weapon newWeapon) override { unit_->setWeapon(newWeapon); }
+    weapon getWeapon() override { return unit_->getWeapon(); }
+    void setBaseStat(int newStat) override { unit_->setBaseStat(newStat); }
+    int getBaseStat() override { return unit_->getBaseStat(); }
+    void makeAttack() override
+    {
+        unit_->makeAttack();
+        damageDealt_ += unit_->getBaseStat();
+    }
+    void makeUltimateAttack() override
+    {
+        unit_->makeUltimateAttack();
+        damageDealt_ += 3 * unit_->getBaseStat();
+    }
+    void blockAttack() override
+    {
+        unit_->blockAttack();
+        blocked_ = true;
+    }
+    int blockedDamage(int damage) override { return unit_->blockedDamage(damage); }
+    void chargeEnemy(std::string enemyToCharge) override { unit_->chargeEnemy(std::move(enemyToCharge)); }
+    void postDeathRambling() override { unit_->postDeathRambling(); }
+    void preDeathRambling() override { unit_->preDeathRambling(); }
+
+    // Score of the current command, reset for the next one
+    int takeDamageDealt() { return std::exchange(damageDealt_, 0); }
+    bool takeBlocked() { return std::exchange(blocked_, false); }
+};
+
+// Sends what the enemies of the current thread say nowhere, until it goes out of scope.
+class SilencedEnemies
+{
+    private:
+    std::ostream nowhere_;
+    std::ostream* previous_;
+    public:
+    SilencedEnemies() : nowhere_(nullptr), previous_(std::exchange(enemyLogTarget(), &nowhere_)) {}
+    SilencedEnemies(const SilencedEnemies&) = delete;
+    SilencedEnemies& operator=(const SilencedEnemies&) = delete;
+    ~SilencedEnemies() { enemyLogTarget() = previous_; }
+};
+
+class CombatSimulation
+{
+    public:
+    static constexpr int RespawnTicks = 10;     // A fallen enemy is replaced after that many ticks
+    static constexpr std::size_t Grain = 1024;  // Enemies per task of the pool
+
+    private:
+    struct Combatant
+    {
+        std::unique_ptr<CombatUnit> unit;
+        std::unique_ptr<Enemy> enemy;
+        bool boss;
+        bool phaseTwoUsed;
+        int deadTicks;
+    };
+    std::vector<Combatant> combatants_;
+    std::vector<int> damageDealt_;      // Written by each enemy for the current tick, summed up in order afterwards
+    std::uint64_t seed_;
+    std::uint64_t tick_;
+    std::uint64_t damageToPlayer_;
+
+    static std::uint64_t mix(std::uint64_t value)
+    {
+        value += 0x9e3779b97f4a7c15ULL;
+        value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        value = (value ^ (value >> 27)) * 0x94d049bb133111ebULL;
+        return value ^ (value >> 31);
+    }
+
+    void stepEnemy(std::size_t index)
+    {
+        Combatant& combatant = combatants_[index];
+        CombatUnit& unit = *combatant.unit;
+        Enemy& enemy = *combatant.enemy;
+        damageDealt_[index] = 0;
+        if(!unit.isAlive())
+        {
+            if(++combatant.deadTicks < RespawnTicks) { return; }
+            combatant.deadTicks = 0;
+            combatant.phaseTwoUsed = false;
+            enemy.ressurect();
+        }
+
+        std::uint64_t roll = mix(seed_ ^ mix(tick_ ^ mix(index)));
+        CombatCommand command = static_cast<CombatCommand>(roll % (combatant.boss ? 3 : 2));
+        int incoming = 5 + static_cast<int>((roll >> 8) % 20);
+        switch(command)
+        {
+            case CombatCommand::ForceAttack: enemy.forceAttack("the player"); break;
+            case CombatCommand::Block: enemy.block(); break;     // A boss strikes back with its attack chain
+            case CombatCommand::AttackChain: static_cast<EnemyBoss&>(enemy).attackChain(); break;
+        }
+        damageDealt_[index] = unit.takeDamageDealt();
+        if(unit.takeBlocked()) { incoming = unit.blockedDamage(incoming); }
+
+        // Kept at 0 at worst, EnemyClass only counts exactly 0 health as dead
+        enemy.hit(std::min(incoming, unit.getHealth()));
+        if(!unit.isAlive() && combatant.boss && !combatant.phaseTwoUsed)
+        {
+            // The boss enters phase 2
+            combatant.phaseTwoUsed = true;
+            enemy.ressurect();
+        }
+    }
+
+    public:
+    explicit CombatSimulation(std::uint64_t seed) : combatants_(), damageDealt_(), seed_(seed), tick_(0), damageToPlayer_(0) {}
+
+    void reserve(std::size_t count)
+    {
+        combatants_.reserve(count);
+        damageDealt_.reserve(count);
+    }
+
+    // Adds an enemy of the given class, the simulation takes ownership of the unit.
+    void addEnemy(EnemyClass* unit, bool boss)
+    {
+        auto combatUnit = std::make_unique<CombatUnit>(unit);
+        Enemy* enemy = boss ? new EnemyBoss(combatUnit.get()) : new Enemy(combatUnit.get());
+        combatants_.push_back(Combatant{std::move(combatUnit), std::unique_ptr<Enemy>(enemy), boss, false, 0});
+        damageDealt_.push_back(0);
+    }
+
+    std::size_t size() const { return combatants_.size(); }
+
+    // Advances the fight by the given number of ticks, all enemies of a tick are processed before the next one starts.
+    void run(WorkStealingPool& pool, std::uint64_t ticks = 1)
+    {
+        for(std::uint64_t i = 0; i < ticks; ++i)
+        {
+            pool.parallelFor(combatants_.size(), Grain, [this](std::size_t begin, std::size_t end)
+            {
+                SilencedEnemies silence;
+                for(std::size_t index = begin; index < end; ++index)
+                {
+                    stepEnemy(index);
+                }
+            });
+            for(int damage : damageDealt_)
+            {
+                damageToPlayer_ += static_cast<std::uint64_t>(damage);
+            }
+            ++tick_;
+        }
+    }
+
+    CombatOutcome outcome() const
+    {
+        CombatOutcome result{tick_, 0, damageToPlayer_, 0};
+        for(const Combatant& combatant : combatants_)
+        {
+            result.alive += combatant.unit->isAlive();
+            result.checksum = mix(result.checksum ^ static_cast<std::uint64_t>(combatant.unit->getHealth()));
+        }
+        return result;
+    }
+};
@@ -0,0 +1,166 @@
+/**
+ * Data oriented implementation side of the Bridge example, for crowds of tens of thousands of enemies. All units of a
+ * crowd are kept as a structure of arrays - one array per field plus an alive bitset - and the abstraction side is a
+ * small handle holding an index into it. Operations on the whole crowd (hitAll, healAll, killIf) are flat loops over
+ * the arrays that the compiler vectorizes.
+ * A unit is alive exactly while its health is above 0, the alive bitset is kept in step with the health array.
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ */
+#pragma once
+
+#include <algorithm>
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "Bridge.h"
+
+class EnemyCrowd
+{
+    private:
+    std::vector<std::string> names_;
+    std::vector<int> health_;
+    std::vector<int> baseStat_;
+    std::vector<weapon> weapons_;
+    std::vector<std::uint64_t> alive_;
+
+    // Rebuilds the alive bits of the given 64 unit word from the health array.
+    void refreshAlive(std::size_t word)
+    {
+        std::size_t first = word * 64;
+        std::size_t lanes = std::min<std::size_t>(64, health_.size() - first);
+        const int* health = health_.data() + first;
+        std::uint64_t bits = 0;
+        for(std::size_t lane = 0; lane < lanes; ++lane)
+        {
+            bits |= static_cast<std::uint64_t>(health[lane] > 0) << lane;
+        }
+        alive_[word] = bits;
+    }
+    void refreshAllAlive()
+    {
+        for(std::size_t word = 0; word < alive_.size(); ++word)
+        {
+            refreshAlive(word);
+        }
+    }
+
+    public:
+    EnemyCrowd() : names_(), health_(), baseStat_(), weapons_(), alive_() {}
+
+    void reserve(std::size_t count)
+    {
+        names_.reserve(count);
+        health_.reserve(count);
+        baseStat_.reserve(count);
+        weapons_.reserve(count);
+        alive_.reserve((count + 63) / 64);
+    }
+
+    // Adds a unit with the same starting values as an EnemyClass, returns its index.
+    std::size_t add(std::string name, weapon heldWeapon)
+    {
+        std::size_t index = health_.size();
+        names_.push_back(name);
+        health_.push_back(100);
+        baseStat_.push_back(10);
+        weapons_.push_back(heldWeapon);
+        if(index % 64 == 0) { alive_.push_back(0); }
+        alive_[index / 64] |= std::uint64_t(1) << (index % 64);
+        return index;
+    }
+
+    std::size_t size() const { return health_.size(); }
+    const std::string& getName(std::size_t index) const { return names_[index]; }
+    int getHealth(std::size_t index) const { return health_[index]; }
+    int getBaseStat(std::size_t index) const { return baseStat_[index]; }
+    weapon getWeapon(std::size_t index) const { return weapons_[index]; }
+    bool isAlive(std::size_t index) const { return (alive_[index / 64] >> (index % 64)) & 1; }
+
+    // Health below 0 is kept at 0, a unit at 0 is dead.
+    void setHealth(std::size_t index, int health)
+    {
+        health_[index] = std::max(health, 0);
+        refreshAlive(index / 64);
+    }
+    void setBaseStat(std::size_t index, int baseStat) { baseStat_[index] = baseStat; }
+    void setWeapon(std::size_t index, weapon heldWeapon) { weapons_[index] = heldWeapon; }
+
+    std::size_t aliveCount() const
+    {
+        std::size_t count = 0;
+        for(std::uint64_t word : alive_)
+        {
+            count += std::bitset<64>(word).count();
+        }
+        return count;
+    }
+
+    // Area hit on every living unit. The dead ones stay at 0 health.
+    void hitAll(int hitPower)
+    {
+        int* health = health_.data();
+        for(std::size_t i = 0; i < health_.size(); ++i)
+        {
+            health[i] = std::max(health[i] - hitPower, 0);
+        }
+        refreshAllAlive();
+    }
+
+    // Heals every living unit, the dead are not brought back by healing.
+    void healAll(int healPower)
+    {
+        int* health = health_.data();
+        for(std::size_t i = 0; i < health_.size(); ++i)
+        {
+            health[i] += health[i] > 0 ? healPower : 0;
+        }
+    }
+
+    // Kills every living unit for which kill(health, baseStat, weapon) is true. Returns how many died.
+    template<typename Predicate>
+    std::size_t killIf(Predicate kill)
+    {
+        int* health = health_.data();
+        const int* baseStat = baseStat_.data();
+        const weapon* weapons = weapons_.data();
+        std::size_t killed = 0;
+        for(std::size_t i = 0; i < health_.size(); ++i)
+        {
+            bool dies = health[i] > 0 && kill(health[i], baseStat[i], weapons[i]);
+            killed += dies;
+            health[i] = dies ? 0 : health[i];
+        }
+        refreshAllAlive();
+        return killed;
+    }
+};
+
+// Abstraction side - an enemy of a crowd, as cheap to copy as the index it holds.
+class CrowdEnemy
+{
+    private:
+    EnemyCrowd* crowd_;
+    std::size_t index_;
+    public:
+    CrowdEnemy(EnemyCrowd* crowd, std::size_t index) : crowd_(crowd), index_(index) {}
+    void hit(int hitPower)
+    { crowd_->setHealth(index_, crowd_->getHealth(index_) - hitPower); }
+    void heal(int healPower)
+    {
+        if(crowd_->isAlive(index_)) { crowd_->setHealth(index_, crowd_->getHealth(index_) + healPower); }
+    }
+    void kill()
+    { crowd_->setHealth(index_, 0); }
+    void ressurect()
+    {
+        if(!crowd_->isAlive(index_)) { crowd_->setHealth(index_, 100); }
+    }
+    bool isAlive() const { return crowd_->isAlive(index_); }
+    int getHealth() const { return crowd_->getHealth(index_); }
+    const std::string& getName() const { return crowd_->getName(index_); }
+    std::size_t index() const { return index_; }
+};
@@ -0,0 +1,150 @@
+/**
+ * Batched lifecycle changes for the units behind the Bridge abstraction. Kills, resurrections and stat changes of a
+ * frame are queued into a command buffer and applied in one pass, where every touched unit is read and written once.
+ * Units that changed are marked in a dirty bitset, and the changes come out as a compact event stream, so the systems
+ * reacting to deaths or stat changes do not have to poll every unit.
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ */
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "Bridge.h"
+
+enum class LifecycleEventType : std::uint8_t
+{
+    Death = 0,
+    Resurrect,
+    StatDelta
+};
+
+// One change of one unit, value is the change of the base stat for StatDelta and 0 otherwise.
+struct LifecycleEvent
+{
+    std::uint32_t unit;
+    LifecycleEventType type;
+    std::int32_t value;
+};
+
+class EnemyLifecycle
+{
+    private:
+    enum class CommandType : std::uint8_t
+    {
+        Kill = 0,
+        Ressurect,
+        StatChange
+    };
+    struct Command
+    {
+        std::uint32_t unit;
+        CommandType type;
+        std::int32_t amount;
+    };
+    std::vector<EnemyClass*> units_;
+    std::vector<Command> pending_;
+    std::vector<std::uint64_t> dirty_;
+    std::vector<LifecycleEvent> events_;
+
+    void markDirty(std::uint32_t unit)
+    { dirty_[unit / 64] |= std::uint64_t(1) << (unit % 64); }
+
+    // Folds the commands of one unit, in the order they were queued, into one read and one write of the unit.
+    void applyUnit(const Command* first, const Command* last)
+    {
+        std::uint32_t index = first->unit;
+        EnemyClass& unit = *units_[index];
+        bool wasAlive = unit.isAlive();
+        bool alive = wasAlive;
+        int statDelta = 0;
+        for(const Command* command = first; command != last; ++command)
+        {
+            switch(command->type)
+            {
+                case CommandType::Kill: alive = false; break;
+                case CommandType::Ressurect: alive = true; break;
+                case CommandType::StatChange: statDelta += command->amount; break;
+            }
+        }
+
+        if(alive != wasAlive)
+        {
+            // Same end state as Enemy::kill and Enemy::ressurect
+            if(alive) { unit.setAlive(true); }
+            unit.setHealth(alive ? 100 : 0);
+            events_.push_back(LifecycleEvent{index, alive ? LifecycleEventType::Resurrect : LifecycleEventType::Death, 0});
+        }
+        if(statDelta != 0)
+        {
+            unit.setBaseStat(unit.getBaseStat() + statDelta);
+            events_.push_back(LifecycleEvent{index, LifecycleEventType::StatDelta, statDelta});
+        }
+        if(alive != wasAlive || statDelta != 0) { markDirty(index); }
+    }
+
+    public:
+    EnemyLifecycle() : units_(), pending_(), dirty_(), events_() {}
+
+    // Adds a unit to the batch, returns its index. The unit is not owned and has to outlive the batch.
+    std::size_t add(EnemyClass* unit)
+    {
+        std::size_t index = units_.size();
+        units_.push_back(unit);
+        if(index % 64 == 0) { dirty_.push_back(0); }
+        return index;
+    }
+    std::size_t size() const { return units_.size(); }
+
+    void queueKill(std::size_t unit)
+    { pending_.push_back(Command{static_cast<std::uint32_t>(unit), CommandType::Kill, 0}); }
+    void queueRessurect(std::size_t unit)
+    { pending_.push_back(Command{static_cast<std::uint32_t>(unit), CommandType::Ressurect, 0}); }
+    void queueStatChange(std::size_t unit, int amount)
+    { pending_.push_back(Command{static_cast<std::uint32_t>(unit), CommandType::StatChange, amount}); }
+    void queueMakeStronger(std::size_t unit) { queueStatChange(unit, 1); }
+    void queueMakeWeaker(std::size_t unit) { queueStatChange(unit, -1); }
+    std::size_t pending() const { return pending_.size(); }
+
+    /// @brief Applies the queued commands and starts a new frame - the dirty bits and the events are those of this
+    /// call only. Commands cancelling each other out (a kill and a resurrection, +1 and -1) leave no event.
+    void apply()
+    {
+        std::fill(dirty_.begin(), dirty_.end(), 0);
+        events_.clear();
+        // Grouped by unit, the order within one unit is kept
+        std::stable_sort(pending_.begin(), pending_.end(), [](const Command& left, const Command& right) { return left.unit < right.unit; });
+        const Command* first = pending_.data();
+        const Command* end = first + pending_.size();
+        while(first != end)
+        {
+            const Command* last = first;
+            while(last != end && last->unit == first->unit) { ++last; }
+            applyUnit(first, last);
+            first = last;
+        }
+        pending_.clear();
+    }
+
+    // Changes of the last frame, ordered by unit.
+    const std::vector<LifecycleEvent>& events() const { return events_; }
+    bool isDirty(std::size_t unit) const { return (dirty_[unit / 64] >> (unit % 64)) & 1; }
+
+    // Calls visit(index) for every unit changed in the last frame, skipping 64 clean units at a time.
+    template<typename Visitor>
+    void forEachDirty(Visitor visit) const
+    {
+        for(std::size_t word = 0; word < dirty_.size(); ++word)
+        {
+            std::uint64_t bits = dirty_[word];
+            while(bits)
+            {
+                visit(word * 64 + static_cast<std::size_t>(__builtin_ctzll(bits)));
+                bits &= bits - 1;
+            }
+        }
+    }
+};
@@ -0,0 +1,66 @@
+/**
+ * Bridge flavors without a virtual call per getter and setter. The implementation is either one of a closed set
+ * (VariantEnemy holds a std::variant of the concrete classes and dispatches once per action with std::visit) or fixed
+ * at compile time (StaticEnemy<Impl>). Both keep the unit by value, and since the concrete classes are final every
+ * call on them is direct and the trivial ones inline.
+ * The virtual Enemy stays the flavor to use when new EnemyClass implementations come at runtime.
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ */
+#pragma once
+
+#include <string>
+#include <utility>
+#include <variant>
+#include "Bridge.h"
+
+using EnemyClassVariant = std::variant<EnemyClassWarrior, EnemyClassMage>;
+
+// Abstraction over the closed set of implementations
+class VariantEnemy
+{
+    private:
+    EnemyClassVariant unit_;
+    public:
+    explicit VariantEnemy(EnemyClassVariant unit) : unit_(std::move(unit)) {}
+    void kill()
+    { std::visit([](auto& unit) { EnemyActions::kill(unit); }, unit_); }
+    void ressurect()
+    { std::visit([](auto& unit) { EnemyActions::ressurect(unit); }, unit_); }
+    void changeWeapon(weapon newWeapon)
+    { std::visit([newWeapon](auto& unit) { EnemyActions::changeWeapon(unit, newWeapon); }, unit_); }
+    void forceAttack(std::string target)
+    { std::visit([&target](auto& unit) { EnemyActions::forceAttack(unit, target); }, unit_); }
+    void hit(int hitPower)
+    { std::visit([hitPower](auto& unit) { EnemyActions::hit(unit, hitPower); }, unit_); }
+    void heal(int healPower)
+    { std::visit([healPower](auto& unit) { EnemyActions::heal(unit, healPower); }, unit_); }
+    void makeStronger()
+    { std::visit([](auto& unit) { EnemyActions::makeStronger(unit); }, unit_); }
+    void makeWeaker()
+    { std::visit([](auto& unit) { EnemyActions::makeWeaker(unit); }, unit_); }
+    void block()
+    { std::visit([](auto& unit) { EnemyActions::block(unit); }, unit_); }
+    EnemyClassVariant& unit() { return unit_; }
+};
+
+// Abstraction over an implementation chosen at compile time
+template<typename Impl>
+class StaticEnemy
+{
+    private:
+    Impl unit_;
+    public:
+    explicit StaticEnemy(Impl unit) : unit_(std::move(unit)) {}
+    void kill() { EnemyActions::kill(unit_); }
+    void ressurect() { EnemyActions::ressurect(unit_); }
+    void changeWeapon(weapon newWeapon) { EnemyActions::changeWeapon(unit_, newWeapon); }
+    void forceAttack(std::string target) { EnemyActions::forceAttack(unit_, target); }
+    void hit(int hitPower) { EnemyActions::hit(unit_, hitPower); }
+    void heal(int healPower) { EnemyActions::heal(unit_, healPower); }
+    void makeStronger() { EnemyActions::makeStronger(unit_); }
+    void makeWeaker() { EnemyActions::makeWeaker(unit_); }
+    void block() { EnemyActions::block(unit_); }
+    Impl& unit() { return unit_; }
+};
@@ -0,0 +1,145 @@
+/**
+ * Small work stealing thread pool used by the combat simulation. Every thread has its own task queue; a thread takes
+ * work from the front of its own queue, and once that is empty it steals from the back of the others.
+ * The thread calling parallelFor works on the tasks as well, until all of them are done.
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ */
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class WorkStealingPool
+{
+    private:
+    using Task = std::function<void()>;
+    struct Queue
+    {
+        std::mutex lock;
+        std::deque<Task> tasks;
+    };
+    std::vector<std::unique_ptr<Queue>> queues_;   // queues_[0] belongs to the thread calling parallelFor
+    std::vector<std::thread> workers_;
+    std::mutex sleepLock_;
+    std::condition_variable wake_;
+    std::atomic<std::size_t> queued_;
+    bool stopping_;
+
+    bool popOwn(std::size_t self, Task& task)
+    {
+        Queue& queue = *queues_[self];
+        std::lock_guard<std::mutex> lock(queue.lock);
+        if(queue.tasks.empty()) { return false; }
+        task = std::move(queue.tasks.front());
+        queue.tasks.pop_front();
+        return true;
+    }
+    bool steal(std::size_t self, Task& task)
+    {
+        for(std::size_t offset = 1; offset < queues_.size(); ++offset)
+        {
+            Queue& queue = *queues_[(self + offset) % queues_.size()];
+            std::lock_guard<std::mutex> lock(queue.lock);
+            if(queue.tasks.empty()) { continue; }
+            task = std::move(queue.tasks.back());
+            queue.tasks.pop_back();
+            return true;
+        }
+        return false;
+    }
+    bool runOne(std::size_t self)
+    {
+        Task task;
+        if(!popOwn(self, task) && !steal(self, task)) { return false; }
+        queued_.fetch_sub(1, std::memory_order_relaxed);
+        task();
+        return true;
+    }
+
+    void work(std::size_t self)
+    {
+        while(true)
+        {
+            if(runOne(self)) { continue; }
+            std::unique_lock<std::mutex> lock(sleepLock_);
+            wake_.wait(lock, [this]() { return stopping_ || queued_.load(std::memory_order_relaxed) > 0; });
+            if(stopping_) { return; }
+        }
+    }
+
+    public:
+    // threadCount counts the calling thread too, so 1 runs everything on the caller. 0 uses every hardware thread.
+    explicit WorkStealingPool(std::size_t threadCount = 0) : queues_(), workers_(), sleepLock_(), wake_(), queued_(0), stopping_(false)
+    {
+        if(threadCount == 0) { threadCount = std::max(1u, std::thread::hardware_concurrency()); }
+        for(std::size_t i = 0; i < threadCount; ++i)
+        {
+            queues_.push_back(std::make_unique<Queue>());
+        }
+        for(std::size_t i = 1; i < threadCount; ++i)
+        {
+            workers_.emplace_back([this, i]() { work(i); });
+        }
+    }
+    WorkStealingPool(const WorkStealingPool&) = delete;
+    WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+    ~WorkStealingPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(sleepLock_);
+            stopping_ = true;
+        }
+        wake_.notify_all();
+        for(auto& worker : workers_) { worker.join(); }
+    }
+
+    std::size_t threadCount() const { return queues_.size(); }
+
+    // Runs body(begin, end) over [0, count) in chunks of grain items and returns once every chunk is done.
+    template<typename Body>
+    void parallelFor(std::size_t count, std::size_t grain, Body body)
+    {
+        grain = std::max<std::size_t>(grain, 1);
+        std::size_t chunkCount = (count + grain - 1) / grain;
+        if(chunkCount <= 1 || queues_.size() == 1)
+        {
+            body(std::size_t(0), count);
+            return;
+        }
+
+        std::atomic<std::size_t> pending(chunkCount);
+        for(std::size_t chunk = 0; chunk < chunkCount; ++chunk)
+        {
+            std::size_t begin = chunk * grain;
+            std::size_t end = std::min(count, begin + grain);
+            // Contiguous runs of chunks per queue, the stealing evens out the rest
+            Queue& queue = *queues_[chunk * queues_.size() / chunkCount];
+            std::lock_guard<std::mutex> lock(queue.lock);
+            queue.tasks.push_back([&body, &pending, begin, end]()
+            {
+                body(begin, end);
+                pending.fetch_sub(1, std::memory_order_acq_rel);
+            });
+        }
+        {
+            std::lock_guard<std::mutex> lock(sleepLock_);
+            queued_.fetch_add(chunkCount, std::memory_order_relaxed);
+        }
+        wake_.notify_all();
+
+        while(pending.load(std::memory_order_acquire) > 0)
+        {
+            if(!runOne(0)) { std::this_thread::yield(); }
+        }
+    }
+};
@@ -0,0 +1,316 @@
+// Benchmarks of the Bridge hot calls: abstraction methods forwarding to the implementation,
+// area operations on a whole crowd of enemies, ticks of the parallel combat simulation, and the virtual bridge against
+// the variant and template ones, and per frame lifecycle changes one by one against the batch.
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <memory>
+#include <random>
+#include <vector>
+#include "Bridge.h"
+#include "CombatSimulation.h"
+#include "EnemyCrowd.h"
+#include "EnemyLifecycle.h"
+#include "QuietOutput.h"
+#include "StaticBridge.h"
+
+static void benchHitHeal(benchmark::State& state)
+{
+    EnemyClassWarrior unit("Mark");
+    Enemy enemy(&unit);
+    for(auto _ : state)
+    {
+        enemy.hit(25);
+        enemy.heal(25);
+    }
+    benchmark::DoNotOptimize(unit.getHealth());
+}
+BENCHMARK(benchHitHeal);
+
+static void benchBossBlock(benchmark::State& state)
+{
+    QuietOutput quiet;
+    EnemyClassMage unit("Merlin");
+    EnemyBoss boss(&unit);
+    for(auto _ : state)
+    {
+        boss.block();
+    }
+}
+BENCHMARK(benchBossBlock);
+
+static void benchKillRessurect(benchmark::State& state)
+{
+    QuietOutput quiet;
+    EnemyClassWarrior unit("Balzahar");
+    EnemyBoss boss(&unit);
+    Enemy* enemy = &boss;
+    for(auto _ : state)
+    {
+        enemy->kill();
+        enemy->ressurect();
+    }
+}
+BENCHMARK(benchKillRessurect);
+
+// Area hit on 100k enemies, followed by a heal so the crowd stays alive across iterations.
+static const std::size_t crowdSize = 100000;
+
+static void benchAreaHitPerEnemy(benchmark::State& state)
+{
+    std::vector<std::unique_ptr<EnemyClass>> units;
+    std::vector<Enemy> enemies;
+    units.reserve(crowdSize);
+    enemies.reserve(crowdSize);
+    for(std::size_t i = 0; i < crowdSize; ++i)
+    {
+        if(i % 2 == 0) { units.emplace_back(new EnemyClassWarrior("Grunt")); }
+        else { units.emplace_back(new EnemyClassMage("Hexer")); }
+        enemies.emplace_back(units.back().get());
+    }
+    for(auto _ : state)
+    {
+        for(Enemy& enemy : enemies)
+        {
+            enemy.hit(5);
+        }
+        for(Enemy& enemy : enemies)
+        {
+            enemy.heal(5);
+        }
+    }
+    benchmark::DoNotOptimize(units.front()->getHealth());
+    state.SetItemsProcessed(state.iterations() * crowdSize);
+}
+BENCHMARK(benchAreaHitPerEnemy)->Unit(benchmark::kMicrosecond);
+
+static void benchAreaHitCrowd(benchmark::State& state)
+{
+    EnemyCrowd crowd;
+    crowd.reserve(crowdSize);
+    for(std::size_t i = 0; i < crowdSize; ++i)
+    {
+        crowd.add(i % 2 == 0 ? "Grunt" : "Hexer", i % 2 == 0 ? oneHandSword : staff);
+    }
+    for(auto _ : state)
+    {
+        crowd.hitAll(5);
+        crowd.healAll(5);
+    }
+    benchmark::DoNotOptimize(crowd.getHealth(0));
+    state.SetItemsProcessed(state.iterations() * crowdSize);
+}
+BENCHMARK(benchAreaHitCrowd)->Unit(benchmark::kMicrosecond);
+
+static void benchKillIfCrowd(benchmark::State& state)
+{
+    EnemyCrowd crowd;
+    crowd.reserve(crowdSize);
+    for(std::size_t i = 0; i < crowdSize; ++i)
+    {
+        crowd.add("Grunt", i % 3 == 0 ? staff : oneHandSword);
+    }
+    for(auto _ : state)
+    {
+        // Nobody has that much health, so the crowd stays the same
+        benchmark::DoNotOptimize(crowd.killIf([](int health, int, weapon heldWeapon) { return heldWeapon == staff && health > 1000; }));
+    }
+    state.SetItemsProcessed(state.iterations() * crowdSize);
+}
+BENCHMARK(benchKillIfCrowd)->Unit(benchmark::kMicrosecond);
+
+// Hit, heal and a stat change on 100k enemies, half warriors and half mages, per bridge flavor.
+static void benchBridgeVirtual(benchmark::State& state)
+{
+    std::vector<std::unique_ptr<EnemyClass>> units;
+    std::vector<std::unique_ptr<Enemy>> enemies;
+    for(std::size_t i = 0; i < crowdSize; ++i)
+    {
+        if(i % 2 == 0) { units.emplace_back(new EnemyClassWarrior("Grunt")); }
+        else { units.emplace_back(new EnemyClassMage("Hexer")); }
+        enemies.emplace_back(new Enemy(units.back().get()));
+    }
+    for(auto _ : state)
+    {
+        for(auto& enemy : enemies)
+        {
+            enemy->hit(5);
+            enemy->heal(5);
+            enemy->makeStronger();
+        }
+    }
+    benchmark::DoNotOptimize(units.front()->getHealth());
+    state.SetItemsProcessed(state.iterations() * crowdSize);
+}
+BENCHMARK(benchBridgeVirtual)->Unit(benchmark::kMicrosecond);
+
+static void benchBridgeVariant(benchmark::State& state)
+{
+    std::vector<VariantEnemy> enemies;
+    enemies.reserve(crowdSize);
+    for(std::size_t i = 0; i < crowdSize; ++i)
+    {
+        if(i % 2 == 0) { enemies.emplace_back(EnemyClassWarrior("Grunt")); }
+        else { enemies.emplace_back(EnemyClassMage("Hexer")); }
+    }
+    for(auto _ : state)
+    {
+        for(VariantEnemy& enemy : enemies)
+        {
+            enemy.hit(5);
+            enemy.heal(5);
+            enemy.makeStronger();
+        }
+    }
+    benchmark::DoNotOptimize(enemies.front().unit());
+    state.SetItemsProcessed(state.iterations() * crowdSize);
+}
+BENCHMARK(benchBridgeVariant)->Unit(benchmark::kMicrosecond);
+
+static void benchBridgeTemplate(benchmark::State& state)
+{
+    std::vector<StaticEnemy<EnemyClassWarrior>> warriors;
+    std::vector<StaticEnemy<EnemyClassMage>> mages;
+    warriors.reserve(crowdSize / 2);
+    mages.reserve(crowdSize / 2);
+    for(std::size_t i = 0; i < crowdSize / 2; ++i)
+    {
+        warriors.emplace_back(EnemyClassWarrior("Grunt"));
+        mages.emplace_back(EnemyClassMage("Hexer"));
+    }
+    for(auto _ : state)
+    {
+        for(auto& warrior : warriors)
+        {
+            warrior.hit(5);
+            warrior.heal(5);
+            warrior.makeStronger();
+        }
+        for(auto& mage : mages)
+        {
+            mage.hit(5);
+            mage.heal(5);
+            mage.makeStronger();
+        }
+    }
+    benchmark::DoNotOptimize(warriors.front().unit());
+    state.SetItemsProcessed(state.iterations() * crowdSize);
+}
+BENCHMARK(benchBridgeTemplate)->Unit(benchmark::kMicrosecond);
+
+// One frame of lifecycle changes on 50k units with 1% churn: 500 kills, resurrections and stat changes, after which
+// a downstream system needs to know which units changed.
+static const std::size_t rosterSize = 50000;
+static const std::size_t churnPerFrame = rosterSize / 100;
+
+static std::vector<std::unique_ptr<EnemyClass>> makeRoster()
+{
+    std::vector<std::unique_ptr<EnemyClass>> units;
+    units.reserve(rosterSize);
+    for(std::size_t i = 0; i < rosterSize; ++i)
+    {
+        if(i % 2 == 0) { units.emplace_back(new EnemyClassWarrior("Grunt")); }
+        else { units.emplace_back(new EnemyClassMage("Hexer")); }
+    }
+    return units;
+}
+
+static std::vector<std::size_t> makeChurn()
+{
+    std::mt19937 random(7);
+    std::uniform_int_distribution<std::size_t> pick(0, rosterSize - 1);
+    std::vector<std::size_t> churn(churnPerFrame * 64);
+    for(std::size_t& unit : churn) { unit = pick(random); }
+    return churn;
+}
+
+// Changes through the Enemy abstraction, the downstream system compares every unit with its copy of the last frame
+static void benchLifecyclePerUnit(benchmark::State& state)
+{
+    QuietOutput quiet;
+    std::vector<std::unique_ptr<EnemyClass>> units = makeRoster();
+    std::vector<Enemy> enemies;
+    enemies.reserve(rosterSize);
+    for(auto& unit : units) { enemies.emplace_back(unit.get()); }
+    std::vector<std::pair<bool, int>> seen(rosterSize, std::make_pair(true, 10));
+    std::vector<std::size_t> churn = makeChurn();
+    std::size_t frame = 0;
+    for(auto _ : state)
+    {
+        const std::size_t* picked = churn.data() + (frame++ % 64) * churnPerFrame;
+        for(std::size_t i = 0; i < churnPerFrame; ++i)
+        {
+            Enemy& enemy = enemies[picked[i]];
+            switch(i % 4)
+            {
+                case 0: enemy.kill(); break;
+                case 1: enemy.ressurect(); break;
+                case 2: enemy.makeStronger(); break;
+                case 3: enemy.makeWeaker(); break;
+            }
+        }
+        std::size_t changed = 0;
+        for(std::size_t i = 0; i < rosterSize; ++i)
+        {
+            std::pair<bool, int> now(units[i]->isAlive(), units[i]->getBaseStat());
+            changed += now != seen[i];
+            seen[i] = now;
+        }
+        benchmark::DoNotOptimize(changed);
+    }
+    state.SetItemsProcessed(state.iterations() * churnPerFrame);
+}
+BENCHMARK(benchLifecyclePerUnit)->Unit(benchmark::kMicrosecond);
+
+static void benchLifecycleBatch(benchmark::State& state)
+{
+    std::vector<std::unique_ptr<EnemyClass>> units = makeRoster();
+    EnemyLifecycle lifecycle;
+    for(auto& unit : units) { lifecycle.add(unit.get()); }
+    std::vector<std::size_t> churn = makeChurn();
+    std::size_t frame = 0;
+    for(auto _ : state)
+    {
+        const std::size_t* picked = churn.data() + (frame++ % 64) * churnPerFrame;
+        for(std::size_t i = 0; i < churnPerFrame; ++i)
+        {
+            switch(i % 4)
+            {
+                case 0: lifecycle.queueKill(picked[i]); break;
+                case 1: lifecycle.queueRessurect(picked[i]); break;
+                case 2: lifecycle.queueMakeStronger(picked[i]); break;
+                case 3: lifecycle.queueMakeWeaker(picked[i]); break;
+            }
+        }
+        lifecycle.apply();
+        std::size_t changed = 0;
+        lifecycle.forEachDirty([&changed](std::size_t) { ++changed; });
+        benchmark::DoNotOptimize(changed);
+        benchmark::DoNotOptimize(lifecycle.events().size());
+    }
+    state.SetItemsProcessed(state.iterations() * churnPerFrame);
+}
+BENCHMARK(benchLifecycleBatch)->Unit(benchmark::kMicrosecond);
+
+// Ticks per second of the combat simulation - range(0) enemies, one in a hundred a boss, on range(1) threads.
+static void benchCombatTicks(benchmark::State& state)
+{
+    std::size_t enemyCount = static_cast<std::size_t>(state.range(0));
+    CombatSimulation simulation(42);
+    simulation.reserve(enemyCount);
+    for(std::size_t i = 0; i < enemyCount; ++i)
+    {
+        EnemyClass* unit = i % 2 == 0 ? static_cast<EnemyClass*>(new EnemyClassWarrior("Grunt")) : new EnemyClassMage("Hexer");
+        simulation.addEnemy(unit, i % 100 == 0);
+    }
+    WorkStealingPool pool(static_cast<std::size_t>(state.range(1)));
+    for(auto _ : state)
+    {
+        simulation.run(pool);
+    }
+    benchmark::DoNotOptimize(simulation.outcome());
+    state.counters["ticks/s"] = benchmark::Counter(static_cast<double>(state.iterations()), benchmark::Counter::kIsRate);
+    state.SetItemsProcessed(state.iterations() * enemyCount);
+}
+BENCHMARK(benchCombatTicks)->ArgsProduct({{1000, 10000, 100000}, {1, 4}})->Unit(benchmark::kMicrosecond)->UseRealTime();
+
+BENCHMARK_MAIN();
@@ -7,307 +7,124 @@
  * @copyright Copyright (c) 2023
  * 
  */
-
 #include <iostream>
 #include <string>
+#include <vector>
+#include "Bridge.h"
+#include "CombatSimulation.h"
+#include "EnemyCrowd.h"
+#include "EnemyLifecycle.h"
+#include "StaticBridge.h"
 
-enum weapon
-{
-    bow = 0,
-    oneHandSword,
-    twoHandSword,
-    staff
-};
-
-// Abstract implementation - interface
-class EnemyClass
+void clientCode(Enemy* enemyEntity)
 {
-    protected:
-    std::string name_;
-    int health_;
-    int baseStat_;
-    weapon heldWeapon_;
-    bool alive_;
-    public:
-    EnemyClass(std::string name, weapon weapon) : name_(name), health_(100), baseStat_(10), heldWeapon_(weapon), alive_(true) {} 
-    virtual void setName(std::string newName)           = 0;
-    virtual std::string getName()                       = 0;
-    virtual bool isAlive()                              = 0;
-    virtual void setAlive(bool newStatus)               = 0;
-    virtual void setHealth(int health)                  = 0;
-    virtual int getHealth()                             = 0;
-    virtual void setWeapon(weapon newWeapon)            = 0;
-    virtual weapon getWeapon()                          = 0;
-    virtual void setBaseStat(int newStat)               = 0;
-    virtual int getBaseStat()                           = 0;
-    virtual void makeAttack()                           = 0;
-    virtual void makeUltimateAttack()                   = 0;
-    virtual void blockAttack()                          = 0;
-    virtual void chargeEnemy(std::string enemyToCharge) = 0;
-    virtual void postDeathRambling()                    = 0;
-    virtual void preDeathRambling()                     = 0;
-    virtual ~EnemyClass() {};
-};
+    enemyEntity->forceAttack("Player");
+    enemyEntity->block();
+    enemyEntity->hit(25);
+    enemyEntity->heal(20);
+    enemyEntity->forceAttack("Player");
+    enemyEntity->kill();
+    enemyEntity->ressurect();
+    enemyEntity->makeStronger();
+    enemyEntity->forceAttack("Player");
+    enemyEntity->block();
+    enemyEntity->forceAttack("Player");
+    enemyEntity->kill();
+}
 
-// Concrete implementation
-class EnemyClassWarrior : public EnemyClass
+void crowdClientCode()
 {
-    public:
-    EnemyClassWarrior(std::string name) : EnemyClass(name, oneHandSword) {}
-    void setName(std::string newName) override
-    { this->name_ = newName; }
-    std::string getName() override
-    { return this->name_; }
-    bool isAlive() override { return alive_; }
-    void setAlive(bool newStatus) override { this->alive_ = newStatus; }
-    void setHealth(int health) override  
-    { 
-        this->health_ = health;
-        if(this->health_ == 0)
-        {
-            this->alive_ = false;
-        }
-    }
-    int getHealth() override
-    { return health_;}
-    weapon getWeapon() override 
-    { return heldWeapon_; }
-    void setWeapon(weapon newWeapon) override 
-    { 
-        if(newWeapon != oneHandSword || newWeapon != twoHandSword)
-        {
-            std::cout << "A warrior shall not use anything exept swords!" << std::endl;
-            return;
-        }
-
-        this->heldWeapon_ = newWeapon;
-    }
-    int getBaseStat() override
-    { return this->baseStat_; }
-    void setBaseStat(int newStat) override
-    { this->baseStat_ = newStat; }
-    void makeAttack() override
+    // A whole crowd lives in one structure of arrays, the enemies are just indices into it
+    EnemyCrowd crowd;
+    std::vector<CrowdEnemy> horde;
+    const char* names[] = {"Grunt", "Brute", "Hexer", "Sparky", "Tank"};
+    const weapon weapons[] = {oneHandSword, twoHandSword, staff, staff, oneHandSword};
+    for(int i = 0; i < 5; i++)
     {
-        std::cout << "A warrior tries to slash you with his sword!" << std::endl;
+        horde.emplace_back(&crowd, crowd.add(names[i], weapons[i]));
     }
-    void makeUltimateAttack() override
-    {
-        std::cout << "A warrior makes his way to try to behead you with his sword doing some sick sword dance" << std::endl;
-    }
-    void blockAttack() override
-    {
-        if(this->heldWeapon_ == twoHandSword)
-        {
-            std::cout << "The warrior is trying to use his sword to block your attack (not very effective!)" << std::endl;
-        }
-        else if(this->heldWeapon_ == oneHandSword)
-        {
-            std::cout << "The warrior is using the shiled to block your attack (effective!)" << std::endl;
-        }
-        else
-        {
-            std::cout << "The warrior scratches his head because he don't know how to use his weapon in a mean of defence (he gets hit)" << std::endl;
-        }
-    }
-    void chargeEnemy(std::string enemyToCharge) override
-    {
-        std::cout << "The warrior is rushing straight towards you screamin!" << std::endl;
-    }
-    void postDeathRambling() override
-    {
-        std::cout << "I, " << this->name_ << " shalln't kneel before you!!" << std::endl;
-        std::cout << "*Dies*" << std::endl;
-    }
-    void preDeathRambling() override
-    {
-        std::cout << "You thought you can kill ME?" << std::endl;
-        std::cout << "*enters phase 2*" << std::endl;
-    }
-};
 
-// concrete implementation
-class EnemyClassMage : public EnemyClass
-{
-    public:
-    EnemyClassMage(std::string name) : EnemyClass(name, staff) {}
-    void setName(std::string newName) override
-    { this->name_ = newName; }
-    std::string getName() override
-    { return this->name_; }
-    bool isAlive() override { return alive_; }
-    void setAlive(bool newStatus) override { this->alive_ = newStatus; }
-    void setHealth(int health) override  
-    { 
-        this->health_ = health;
-        if(this->health_ == 0)
-        {
-            this->alive_ = false;
-        }
-    }
-    int getHealth() override
-    { return health_;}
-    weapon getWeapon() override 
-    { return heldWeapon_; }
-    void setWeapon(weapon newWeapon) override 
-    { 
-        if(newWeapon == twoHandSword)
-        {
-            std::cout << "A mage codex forbids them from using two handed swords" << std::endl;
-            return;
-        }
-
-        this->heldWeapon_ = newWeapon;
-    }
-    int getBaseStat() override
-    { return this->baseStat_; }
-    void setBaseStat(int newStat) override
-    { this->baseStat_ = newStat; }
-    void makeAttack() override
+    std::cout << "Horde encounter!" << std::endl;
+    horde[4].heal(50);
+    crowd.hitAll(70);
+    crowd.healAll(10);
+    std::size_t killed = crowd.killIf([](int, int, weapon heldWeapon) { return heldWeapon == staff; });
+    std::cout << "A holy wave has taken down " << killed << " mages." << std::endl;
+    crowd.hitAll(40);
+    std::cout << crowd.aliveCount() << " of " << crowd.size() << " enemies are still standing." << std::endl;
+    for(const CrowdEnemy& enemy : horde)
     {
-        std::cout << "The mage is using his stuff in order to cast a deadly spell!" << std::endl;
+        std::cout << enemy.getName() << ": " << (enemy.isAlive() ? "alive" : "dead") << " with " << enemy.getHealth() << " health" << std::endl;
     }
-    void makeUltimateAttack() override
-    {
-        std::cout << "The mage is shooting at you with a great fireball with a power of a nuclear warhead!" << std::endl;
-    }
-    void blockAttack() override
-    {
-        if(this->heldWeapon_ == twoHandSword)
-        {
-            std::cout << "The mage surrenders and accepts his fate as he broken the sacred law." << std::endl;
-        }
-        else
-        {
-            std::cout << "The mage is casting a defensive spell, which addapts to your means of weaponry! (super effective!!!)" << std::endl;
-        }
-    }
-    void chargeEnemy(std::string enemyToCharge) 
-    {
-        std::cout << "The mage put out his scroll while looking at you, ready to make a move." << std::endl;
-    }
-    void postDeathRambling() override
-    {
-        std::cout << "Starts talking about the life and death and the importance of it, also trying to get your zodiac sign before death(weird)." << std::endl;
-        std::cout << "*Dies*" << std::endl;
-    }
-    void preDeathRambling() override
-    {
-        std::cout << "You're a smart and shrewd boy, but enough is enough." << std::endl;
-        std::cout << "*enters phase 2*" << std::endl;
-    }
-};
+}
 
-// Abstraction
-class Enemy
+void variantClientCode()
 {
-    protected:
-    EnemyClass* unit_;
-    public:
-    Enemy(EnemyClass* startingClass) : unit_(startingClass) {}
-    virtual void kill()
-    {
-        if(unit_->isAlive())
-        {
-            std::cout << "A Godly force has cursed " << unit_->getName()  << ", and thus it dies." << std::endl;
-            unit_->setHealth(unit_->getHealth() - unit_->getHealth());
-        }
-    }
-    virtual void ressurect()
-    { 
-        if(!unit_->isAlive())
-        {
-            std::cout << "A Godly force has ressurected the fallen unit! " << unit_->getName() << " is back alive!" << std::endl;
-            unit_->setAlive(true);
-            unit_->setHealth(100);
-        }
-    }
-    virtual void changeWeapon(weapon newWeapon)
-    {
-        std::cout << "Log: Changed " << unit_->getName() << " to " << newWeapon << std::endl; 
-        unit_->setWeapon(newWeapon);
-    }
-
-    virtual void forceAttack(std::string target)
-    {
-        unit_->chargeEnemy(target);
-        unit_->makeAttack();
-    }
-    // Hit as hit the selected unit
-    virtual void hit(int hitPower)
-    {
-        unit_->setHealth(unit_->getHealth() - hitPower);
-    }
+    // Same fight with the implementation picked from a closed set, and with one fixed at compile time
+    std::cout << "Variant mage encounter!" << std::endl;
+    VariantEnemy mage(EnemyClassMage("Torrent"));
+    mage.forceAttack("Player");
+    mage.block();
+    mage.kill();
+
+    std::cout << "Template warrior encounter!" << std::endl;
+    StaticEnemy<EnemyClassWarrior> warrior(EnemyClassWarrior("Mark"));
+    warrior.makeStronger();
+    warrior.forceAttack("Player");
+    warrior.hit(100);
+    warrior.ressurect();
+    std::cout << warrior.unit().getName() << " is back with " << warrior.unit().getHealth() << " health and strength " << warrior.unit().getBaseStat() << std::endl;
+}
 
-    virtual void heal(int healPower)
-    {
-        unit_->setHealth(unit_->getHealth() + healPower);
-    }
-    virtual void makeStronger()
-    {
-        int currentLvl = unit_->getBaseStat();
-        unit_->setBaseStat(currentLvl++);
-    }
-    virtual void makeWeaker()
-    {
-        int currentLvl = unit_->getBaseStat();
-        unit_->setBaseStat(currentLvl--);
-    }
-    virtual void block()
+CombatOutcome simulateBattle(std::size_t threadCount)
+{
+    CombatSimulation simulation(2023);
+    for(int i = 0; i < 5000; i++)
     {
-        unit_->blockAttack();
+        EnemyClass* unit = i % 2 == 0 ? static_cast<EnemyClass*>(new EnemyClassWarrior("Grunt")) : new EnemyClassMage("Hexer");
+        simulation.addEnemy(unit, i % 100 == 0);
     }
-    virtual ~Enemy() {}
-};
+    WorkStealingPool pool(threadCount);
+    simulation.run(pool, 50);
+    return simulation.outcome();
+}
 
-// Extended abstraction
-class EnemyBoss : public Enemy
+void battleClientCode()
 {
-    public:
-    EnemyBoss(EnemyClass* bossClass) : Enemy(bossClass) {} 
-    void ressurect() override
-    {
-        if(!unit_->isAlive())
-        {
-            unit_->preDeathRambling();
-            unit_->setAlive(true);
-            unit_->setHealth(100);
-        }
-    }
-    void kill() override
-    {
-        if(unit_->isAlive())
-        {
-            unit_->postDeathRambling();
-            unit_->setHealth(unit_->getHealth() - unit_->getHealth());
-        }
-    }
-    void block() override
-    { 
-        unit_->blockAttack();
-        attackChain();
-    }
-    virtual void attackChain()
-    {
-        unit_->makeAttack();
-        unit_->makeAttack();
-        unit_->makeUltimateAttack();
-    }
-};
+    // The same seed gives the same battle, whatever the number of threads simulating it
+    std::cout << "Battle of 5000 enemies!" << std::endl;
+    CombatOutcome serial = simulateBattle(1);
+    CombatOutcome parallel = simulateBattle(4);
+    std::cout << "After " << serial.ticks << " ticks " << serial.alive << " enemies stand, the player took " << serial.damageToPlayer << " damage." << std::endl;
+    std::cout << "Replayed on 4 threads: " << (serial == parallel ? "same outcome" : "different outcome") << std::endl;
+}
 
-void clientCode(Enemy* enemyEntity)
+void lifecycleClientCode()
 {
-    enemyEntity->forceAttack("Player");
-    enemyEntity->block();
-    enemyEntity->hit(25);
-    enemyEntity->heal(20);
-    enemyEntity->forceAttack("Player");
-    enemyEntity->kill();
-    enemyEntity->ressurect();
-    enemyEntity->makeStronger();
-    enemyEntity->forceAttack("Player");
-    enemyEntity->block();
-    enemyEntity->forceAttack("Player");
-    enemyEntity->kill();
+    // A frame worth of changes, applied in one go and reported as events
+    EnemyClassWarrior grunt("Grunt");
+    EnemyClassMage hexer("Hexer");
+    EnemyClassWarrior brute("Brute");
+    EnemyLifecycle lifecycle;
+    lifecycle.add(&grunt);
+    lifecycle.add(&hexer);
+    lifecycle.add(&brute);
+
+    std::cout << "End of the frame!" << std::endl;
+    lifecycle.queueMakeStronger(0);
+    lifecycle.queueMakeStronger(0);
+    lifecycle.queueKill(1);
+    lifecycle.queueKill(2);
+    lifecycle.queueRessurect(2);
+    lifecycle.apply();
+    const char* eventNames[] = {"died", "was ressurected", "changed strength by"};
+    for(const LifecycleEvent& event : lifecycle.events())
+    {
+        std::cout << "Unit " << event.unit << " " << eventNames[static_cast<int>(event.type)];
+        if(event.type == LifecycleEventType::StatDelta) { std::cout << " " << event.value; }
+        std::cout << std::endl;
+    }
+    std::cout << grunt.getName() << " has strength " << grunt.getBaseStat() << ", " << brute.getName() << " was " << (lifecycle.isDirty(2) ? "changed" : "not changed") << std::endl;
 }
 
 int main()
@@ -358,4 +175,16 @@ int main()
     // Delete
     delete bossMage;
     delete concreteBossMageFighter;
+
+    // Crowd encounter
+    crowdClientCode();
+
+    // Parallel battle
+    battleClientCode();
+
+    // Devirtualized bridges
+    variantClientCode();
+
+    // Batched lifecycle
+    lifecycleClientCode();
 }
\ No newline at end of file
@@ -0,0 +1,578 @@
+/**
+ * Classes of the Composite example, shared by the demo (main.cpp) and its benchmark (bench.cpp).
+ * The pattern itself is described in the header of main.cpp.
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ */
+#pragma once
+
+#include <iostream>
+#include <vector>
+#include <string>
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+// Stream the members talk to. It is std::cout, unless a thread collects what its members say (ParallelComposite.h).
+inline std::ostream*& memberLogTarget()
+{
+    thread_local std::ostream* target = &std::cout;
+    return target;
+}
+inline std::ostream& memberLog() { return *memberLogTarget(); }
+
+class MembersMonitor;
+
+// What a monitor indexes its members by
+enum class MemberGroup
+{
+    Departament = 0,
+    Sector,
+    Team
+};
+
+// Common interface
+class CompanyMember
+{
+    private:
+    friend class MembersMonitor;
+    // A monitor holding this member directly, where the member is in it, and how much the member adds to its totals
+    struct MonitorLink
+    {
+        MembersMonitor* monitor;
+        std::size_t position;
+        long long salary;
+        long long headcount;
+    };
+    // Nearly every member is in a single monitor, that link is kept without another allocation
+    struct MonitorLinks
+    {
+        MonitorLink first;
+        std::vector<MonitorLink> more;
+        // Set by a MembersMonitor for as long as its members are there - read instead of a dynamic_cast, which would
+        // not find the monitor in a member being destroyed anyway
+        bool holdsMembers;
+    };
+    // Allocated when the member joins its first monitor (by a monitor for itself at once), so a member no monitor holds
+    // (a copy kept by value, like those of FlatComposite.h) carries a single null pointer
+    std::unique_ptr<MonitorLinks> links_;
+
+    bool isLinked() const { return links_ && links_->first.monitor; }
+    bool holdsMembers() const { return links_ && links_->holdsMembers; }
+    // Calls action with the link of every monitor holding this member
+    template<typename Action>
+    void forEachLink(Action action)
+    {
+        if(!isLinked()) { return; }
+        action(links_->first);
+        for(MonitorLink& link : links_->more)
+        {
+            action(link);
+        }
+    }
+    // The link of the monitor that holds this member at position
+    MonitorLink& linkAt(const MembersMonitor* monitor, std::size_t position)
+    {
+        MonitorLink& first = links_->first;
+        if(first.monitor == monitor && first.position == position) { return first; }
+        return *std::find_if(links_->more.begin(), links_->more.end(), [monitor, position](const MonitorLink& link)
+        { return link.monitor == monitor && link.position == position; });
+    }
+    MonitorLink* findLink(const MembersMonitor* monitor)
+    {
+        if(!links_) { return nullptr; }
+        if(links_->first.monitor == monitor) { return &links_->first; }
+        auto it = std::find_if(links_->more.begin(), links_->more.end(), [monitor](const MonitorLink& link) { return link.monitor == monitor; });
+        return it != links_->more.end() ? &*it : nullptr;
+    }
+    MonitorLink& addLink(MembersMonitor* monitor)
+    {
+        if(!links_) { links_ = std::make_unique<MonitorLinks>(MonitorLinks{MonitorLink{nullptr, 0, 0, 0}, {}, false}); }
+        if(!links_->first.monitor)
+        {
+            links_->first = MonitorLink{monitor, 0, 0, 0};
+            return links_->first;
+        }
+        links_->more.push_back(MonitorLink{monitor, 0, 0, 0});
+        return links_->more.back();
+    }
+    // The block stays allocated, a member moved from one monitor to another does not allocate again
+    void dropLink(MonitorLink& link)
+    {
+        std::vector<MonitorLink>& more = links_->more;
+        if(&link == &links_->first)
+        {
+            links_->first.monitor = nullptr;
+            if(!more.empty())
+            {
+                links_->first = more.back();
+                more.pop_back();
+            }
+            return;
+        }
+        link = more.back();
+        more.pop_back();
+    }
+
+    protected:
+    // Passes a change of the totals of this member up to every monitor above it
+    void reportChange(long long salaryDelta, long long headcountDelta);
+    public:
+    CompanyMember() : links_() {}
+    // A copy is a new member, not a member of the monitors of the original - and so is the target of a move
+    CompanyMember(const CompanyMember&) : CompanyMember() {}
+    CompanyMember(CompanyMember&&) noexcept : CompanyMember() {}
+    CompanyMember& operator=(const CompanyMember&) { return *this; }
+    CompanyMember& operator=(CompanyMember&&) noexcept { return *this; }
+    virtual void presentSelf() = 0;
+    virtual void work() = 0;
+    virtual void takeBreak() = 0;
+    // Payroll and headcount of everything under this member, the member itself included
+    virtual long long totalSalary() const { return 0; }
+    virtual std::size_t headcount() const { return 0; }
+    // Name of the group of the member, empty when it is not assigned to one
+    virtual const std::string& getGroup(MemberGroup) const
+    {
+        static const std::string unassigned;
+        return unassigned;
+    }
+    // Leaves every monitor holding it. The monitors take off what the links say the member added, so no virtual call
+    // is made on the half destroyed member.
+    virtual ~CompanyMember();
+};
+
+// Leafs
+class CEO : public CompanyMember
+{
+    protected:
+    std::string startingDate_;
+    int salary_;
+    public:
+    std::string name_;
+    CEO(std::string name, std::string startDate, int salary) : startingDate_(startDate), salary_(salary), name_(name) {}
+    int getSalary() const { return salary_; }
+    void setSalary(int salary)
+    {
+        long long delta = static_cast<long long>(salary) - salary_;
+        salary_ = salary;
+        reportChange(delta, 0);
+    }
+    long long totalSalary() const override { return salary_; }
+    std::size_t headcount() const override { return 1; }
+    void presentSelf() override
+    {
+        memberLog() << "I am " << this->name_ << ". I am a CEO of this company since " << this->startingDate_ << std::endl;
+    }
+    void work() override
+    {
+        memberLog() << this->name_ << " points towards the direction of where the company is going. - He has a lot of meetings developing a new strategies " << std::endl;
+    }
+    void takeBreak() override
+    {
+        memberLog() << this->name_ << " goes on a trip to a tropical island of Janmayen, to refresh his mind." << std::endl;
+    }
+};
+
+class HeadOfDepartament : public CEO
+{
+    protected:
+    std::string departamentAssigned_;
+    public:
+    HeadOfDepartament(std::string name, std::string startDate, int salary, std::string departament) : CEO(name, startDate, salary), departamentAssigned_(departament) {}
+    const std::string& getGroup(MemberGroup group) const override
+    { return group == MemberGroup::Departament ? departamentAssigned_ : CEO::getGroup(group); }
+    void presentSelf() override 
+    {
+        memberLog() << "My name is " << this->name_ << ". I am head of the " << departamentAssigned_ << " departament. I work here since " << startingDate_ << std::endl;
+    }
+    void work() override
+    {
+        memberLog() << this->name_ << " tries to develop the best strategy in departament of " << departamentAssigned_ << " in order to aquire the best quaterly result. " << std::endl;
+    }
+    void takeBreak() override
+    {
+        memberLog() << this->name_ << " spends some time with his colleagues on a golf club! " << std::endl;
+    }
+
+};
+
+class SectorManager : public HeadOfDepartament
+{
+    protected:
+    std::string sectorAssigned_;
+    public:
+    SectorManager(std::string name, std::string startDate, int salary, std::string departament, std::string sector) :
+    HeadOfDepartament(name, startDate, salary, departament), sectorAssigned_(sector) {}
+    const std::string& getGroup(MemberGroup group) const override
+    { return group == MemberGroup::Sector ? sectorAssigned_ : HeadOfDepartament::getGroup(group); }
+    void presentSelf() override
+    {
+        memberLog() << this->name_ << " here. I am a manager at " << this->sectorAssigned_ << "sector, in " << this->departamentAssigned_ <<". I work here since " << this->startingDate_ << std::endl;
+    }
+    void work() override
+    {
+        memberLog() << this->name_ << " cooridinates team leaders in his sector so that each feature/service will be delivered on time." << std::endl;
+    }
+    void takeBreak() override
+    {
+        memberLog() << this->name_ << " travles into a different country via plane or train." << std::endl;
+    }
+};
+
+class TeamLeader : public SectorManager
+{
+    protected: 
+    std::string teamAssigned_;
+    public:
+    TeamLeader(std::string name, std::string startDate, int salary, std::string departament, std::string sector, std::string team) : SectorManager(name, startDate, salary, departament, sector), teamAssigned_(team) {}
+    const std::string& getGroup(MemberGroup group) const override
+    { return group == MemberGroup::Team ? teamAssigned_ : SectorManager::getGroup(group); }
+    void presentSelf() override
+    {
+        memberLog() << "Hi! My name is " << this->name_ << " lead my team to deliver the best quality feature! I work in team " << this->teamAssigned_ << " at sector " << this->sectorAssigned_ << " in " << this->departamentAssigned_ << " departament. I also work here since " << this->startingDate_ << std::endl; 
+    }
+    void work() override
+    {
+        memberLog() << this->name_ << " organizes meeting for his team, as well as helping them to maintain the best atmosphere around." << std::endl;
+    }
+    void takeBreak() override
+    {
+        memberLog() << this->name_ << " loves to have a good in a movie theater, and travel from time to time." << std::endl;
+    }
+};
+
+// Composite
+// Keeps the payroll and headcount of everything under it. The members report every change to the monitors holding
+// them, so an update costs O(depth) and both totals are read in O(1).
+// Every member knows its place in the monitor, so removing one is O(1) - the last member takes the free place, the
+// order of the members is not kept. From the first lookup on, every member under the monitor, nested monitors
+// included, is also indexed by departament, sector and team. Members joining or leaving anywhere below are passed up
+// to the indexes the same way as the totals - a nested monitor joining or leaving an indexed one brings or takes its
+// whole subtree.
+class MembersMonitor : public CompanyMember
+{
+    private:
+    struct Group;
+    // Where a member is in the index, per MemberGroup, and along how many paths down the tree this monitor holds it
+    struct IndexEntry
+    {
+        Group* groups[3];
+        std::size_t slots[3];
+        std::size_t paths;
+    };
+    // Members of one departament, sector or team, with their entries - the entries do not move in entries_
+    struct Group
+    {
+        std::vector<CompanyMember*> members;
+        std::vector<IndexEntry*> entries;
+    };
+    using MemberIndex = std::unordered_map<std::string, Group>;
+    // The totals first, they are what a change passing through touches
+    long long totalSalary_;
+    std::size_t headcount_;
+    std::vector<CompanyMember*> members_;
+    // Built on the first lookup, a monitor nobody searches in does not pay for keeping them. Lookups are const and may
+    // run on several threads at once, so the build runs once under indexOnce_; add and remove anywhere in the tree
+    // need exclusive access.
+    mutable std::once_flag indexOnce_;
+    mutable bool indexed_;
+    mutable std::unordered_map<const CompanyMember*, IndexEntry> entries_;
+    mutable MemberIndex indexes_[3];
+
+    // Calls action with member and everything under it, once for every path down to a member
+    template<typename Action>
+    static void forEachUnder(CompanyMember* member, Action& action)
+    {
+        action(member);
+        if(member->holdsMembers())
+        {
+            for(CompanyMember* nested : static_cast<const MembersMonitor*>(member)->members_)
+            {
+                forEachUnder(nested, action);
+            }
+        }
+    }
+
+    // One more path to member. A member without a group is not kept.
+    void indexMember(CompanyMember* member) const
+    {
+        auto found = entries_.find(member);
+        if(found != entries_.end())
+        {
+            ++found->second.paths;
+            return;
+        }
+        IndexEntry* entry = nullptr;
+        for(int group = 0; group < 3; ++group)
+        {
+            const std::string& name = member->getGroup(static_cast<MemberGroup>(group));
+            if(name.empty()) { continue; }
+            if(!entry) { entry = &entries_.emplace(member, IndexEntry{{nullptr, nullptr, nullptr}, {0, 0, 0}, 1}).first->second; }
+            Group& list = indexes_[group][name];
+            entry->groups[group] = &list;
+            entry->slots[group] = list.members.size();
+            list.members.push_back(member);
+            list.entries.push_back(entry);
+        }
+    }
+    // One path less, the member leaves the index with the last one. The last member of a group takes the free slot.
+    // Only the entry is read, no virtual call is made on a member being destroyed.
+    void unindexMember(const CompanyMember* member)
+    {
+        auto found = entries_.find(member);
+        if(found == entries_.end() || --found->second.paths > 0) { return; }
+        IndexEntry& entry = found->second;
+        for(int group = 0; group < 3; ++group)
+        {
+            Group* list = entry.groups[group];
+            if(!list) { continue; }
+            std::size_t slot = entry.slots[group];
+            std::size_t last = list->members.size() - 1;
+            if(slot != last)
+            {
+                list->members[slot] = list->members[last];
+                list->entries[slot] = list->entries[last];
+                list->entries[slot]->slots[group] = slot;
+            }
+            list->members.pop_back();
+            list->entries.pop_back();
+        }
+        entries_.erase(found);
+    }
+    // member and everything under it joined or left this monitor, the indexes up to the top follow
+    void membersChanged(CompanyMember* member, bool joined)
+    {
+        if(indexed_)
+        {
+            auto update = [this, joined](CompanyMember* changed)
+            {
+                if(joined) { indexMember(changed); }
+                else { unindexMember(changed); }
+            };
+            forEachUnder(member, update);
+        }
+        forEachLink([member, joined](MonitorLink& link) { link.monitor->membersChanged(member, joined); });
+    }
+
+    void subtreeChanged(long long salaryDelta, long long headcountDelta)
+    {
+        totalSalary_ += salaryDelta;
+        headcount_ = static_cast<std::size_t>(static_cast<long long>(headcount_) + headcountDelta);
+        reportChange(salaryDelta, headcountDelta);
+    }
+    // Takes out the member at position, the last one moves into its place. The totals are up to the caller.
+    void unlinkAt(std::size_t position)
+    {
+        CompanyMember* member = members_[position];
+        membersChanged(member, false);
+        member->dropLink(member->linkAt(this, position));
+
+        std::size_t last = members_.size() - 1;
+        if(position != last)
+        {
+            CompanyMember* moved = members_[last];
+            moved->linkAt(this, last).position = position;
+            members_[position] = moved;
+        }
+        members_.pop_back();
+    }
+    // Takes out every member. The own index is emptied at once instead of member by member, the indexes above still
+    // follow every member.
+    void unlinkAll()
+    {
+        bool indexed = indexed_;
+        indexed_ = false;
+        entries_.clear();
+        for(MemberIndex& index : indexes_)
+        {
+            index.clear();
+        }
+        while(!members_.empty())
+        {
+            unlinkAt(members_.size() - 1);
+        }
+        indexed_ = indexed;
+    }
+    friend class CompanyMember;
+
+    public:
+    MembersMonitor() : totalSalary_(0), headcount_(0), members_(), indexOnce_(), indexed_(false), entries_(), indexes_()
+    {
+        links_ = std::make_unique<MonitorLinks>(MonitorLinks{MonitorLink{nullptr, 0, 0, 0}, {}, true});
+    }
+    MembersMonitor(const MembersMonitor&) = delete;
+    MembersMonitor& operator=(const MembersMonitor&) = delete;
+    ~MembersMonitor() override
+    {
+        unlinkAll();
+        links_->holdsMembers = false;
+    }
+
+    // Manipulate data container.
+    void add(CompanyMember* newMember)
+    {
+        CompanyMember::MonitorLink& link = newMember->addLink(this);
+        link.position = members_.size();
+        link.salary = newMember->totalSalary();
+        link.headcount = static_cast<long long>(newMember->headcount());
+        members_.push_back(newMember);
+        membersChanged(newMember, true);
+        subtreeChanged(link.salary, link.headcount);
+    }
+    void remove(CompanyMember* removeMember) 
+    { 
+        //Find member
+        CompanyMember::MonitorLink* link = removeMember->findLink(this);
+        // Remove if present
+        if(link)
+        {
+            long long salary = link->salary;
+            long long headcount = link->headcount;
+            unlinkAt(link->position);
+            subtreeChanged(-salary, -headcount);
+            return;
+        }
+    }
+
+    void removeAll()
+    {
+        unlinkAll();
+        subtreeChanged(-totalSalary_, -static_cast<long long>(headcount_));
+    }
+    const std::vector<CompanyMember*>& members() const { return members_; }
+
+    /// @brief Members under this monitor assigned to the named group, members of nested monitors included, empty if
+    /// there are none.
+    /// @note A member held along several paths is listed once.
+    const std::vector<CompanyMember*>& membersOf(MemberGroup group, const std::string& name) const
+    {
+        static const std::vector<CompanyMember*> nobody;
+        std::call_once(indexOnce_, [this]()
+        {
+            auto index = [this](CompanyMember* member) { indexMember(member); };
+            for(CompanyMember* member : members_)
+            {
+                forEachUnder(member, index);
+            }
+            indexed_ = true;
+        });
+        const MemberIndex& index = indexes_[static_cast<int>(group)];
+        auto it = index.find(name);
+        return it != index.end() ? it->second.members : nobody;
+    }
+    const std::vector<CompanyMember*>& departament(const std::string& name) const { return membersOf(MemberGroup::Departament, name); }
+    const std::vector<CompanyMember*>& sector(const std::string& name) const { return membersOf(MemberGroup::Sector, name); }
+    const std::vector<CompanyMember*>& team(const std::string& name) const { return membersOf(MemberGroup::Team, name); }
+
+    long long totalSalary() const override { return totalSalary_; }
+    std::size_t headcount() const override { return headcount_; }
+
+    /// @brief Recounts the totals from the leaves and compares them with the kept ones, in this monitor and in every
+    /// monitor under it.
+    /// @return false if any of them is off.
+    bool checkAggregates() const
+    {
+        long long salary = 0;
+        std::size_t count = 0;
+        bool consistent = true;
+        for(CompanyMember* member : members_)
+        {
+            if(const MembersMonitor* monitor = dynamic_cast<const MembersMonitor*>(member))
+            {
+                consistent = monitor->checkAggregates() && consistent;
+            }
+            salary += member->totalSalary();
+            count += member->headcount();
+        }
+        return consistent && salary == totalSalary_ && count == headcount_;
+    }
+
+    // Force every employee from within members_ to do specific task
+    void presentSelf() override
+    {
+        for(auto member : members_)
+        {
+            member->presentSelf();
+        }
+    }
+    void work() override
+    {
+        for(auto member : members_)
+        {
+            member->work();
+        }
+    }
+    void takeBreak() override
+    {
+        for(auto member : members_)
+        {
+            member->takeBreak();
+        }
+    }
+};
+
+inline void CompanyMember::reportChange(long long salaryDelta, long long headcountDelta)
+{
+    forEachLink([salaryDelta, headcountDelta](MonitorLink& link)
+    {
+        link.salary += salaryDelta;
+        link.headcount += headcountDelta;
+        link.monitor->subtreeChanged(salaryDelta, headcountDelta);
+    });
+}
+
+inline CompanyMember::~CompanyMember()
+{
+    while(isLinked())
+    {
+        links_->first.monitor->remove(this);
+    }
+}
+
+// Client code, here so the benchmark can time combineCompanySelection as the demo runs it
+class ClientClass
+{
+    public:
+    MembersMonitor* companySurvailanceProgram_;
+
+    ClientClass(MembersMonitor* csp) : companySurvailanceProgram_(csp) {}
+
+    void loadCompany(std::vector<CompanyMember*> loadMembers)
+    {
+        for(auto member : loadMembers)
+        {
+            companySurvailanceProgram_->add(member);
+        }
+    }
+
+    void survailance()
+    {
+        std::cout << "From January untill June & September to December this year: " << std::endl;
+        companySurvailanceProgram_->work();
+        std::cout << "Remainder of this year" << std::endl;
+        companySurvailanceProgram_->takeBreak();
+    }
+
+    void combineCompanySelection(std::vector<CompanyMember*> newCompany)
+    {
+        MembersMonitor* advancedCSP = new MembersMonitor;
+        for(auto member : newCompany)
+        {
+            advancedCSP->add(member);
+            companySurvailanceProgram_->remove(member); 
+        }
+        
+        companySurvailanceProgram_->add(advancedCSP);
+        companySurvailanceProgram_->presentSelf();
+        delete advancedCSP;
+        
+        // Here is a little work around - so we can keep the original newCopmany vector values after advancedCSP has been removed
+        delete companySurvailanceProgram_;
+        companySurvailanceProgram_ = new MembersMonitor;
+        this->loadCompany(newCompany);
+    }
+
+    ~ClientClass() { std::cout << "Deleting client Class" << std::endl; delete companySurvailanceProgram_; }
+};
@@ -0,0 +1,193 @@
+/**
+ * Flattened Composite for org charts of millions of members. All nodes of the tree are kept in pre-order in one array,
+ * every node knows where its subtree ends, and a tag tells which kind of member it is. The members themselves are
+ * stored by value, one array per kind, in the order they appear in the tree.
+ * An operation on a whole subtree is a linear scan of the node array that calls the members without a virtual call,
+ * and FlatMembersMonitor puts the usual CompanyMember interface in front of any subtree.
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <typeinfo>
+#include <vector>
+#include "Composite.h"
+
+enum class MemberKind : std::uint8_t
+{
+    Monitor = 0,
+    CEO,
+    HeadOfDepartament,
+    SectorManager,
+    TeamLeader,
+    Foreign         // Any other CompanyMember, called through its pointer
+};
+
+// The member arrays grow by moving their members, which must not fall back to copying every string
+static_assert(std::is_nothrow_move_constructible<TeamLeader>::value, "Members have to be nothrow movable");
+
+class FlatCompany
+{
+    public:
+    struct Node
+    {
+        MemberKind kind;
+        std::uint32_t index;        // Into the array of its kind, unused for monitors
+        std::uint32_t subtreeEnd;   // One past the last node of its subtree
+    };
+
+    enum class MemberAction
+    {
+        PresentSelf = 0,
+        Work,
+        TakeBreak
+    };
+
+    private:
+    std::vector<Node> nodes_;
+    std::vector<CEO> ceos_;
+    std::vector<HeadOfDepartament> heads_;
+    std::vector<SectorManager> sectorManagers_;
+    std::vector<TeamLeader> teamLeaders_;
+    std::vector<CompanyMember*> foreign_;
+    std::vector<std::uint32_t> openMonitors_;
+
+    // Called with the exact class, so the call is a direct one
+    template<typename Member>
+    static void performOn(Member& member, MemberAction action)
+    {
+        switch(action)
+        {
+            case MemberAction::PresentSelf: member.Member::presentSelf(); break;
+            case MemberAction::Work: member.Member::work(); break;
+            case MemberAction::TakeBreak: member.Member::takeBreak(); break;
+        }
+    }
+
+    std::size_t appendLeaf(MemberKind kind, std::size_t index)
+    {
+        std::size_t node = nodes_.size();
+        nodes_.push_back(Node{kind, static_cast<std::uint32_t>(index), static_cast<std::uint32_t>(node + 1)});
+        return node;
+    }
+
+    public:
+    FlatCompany() : nodes_(), ceos_(), heads_(), sectorManagers_(), teamLeaders_(), foreign_(), openMonitors_() {}
+
+    // Building in pre-order: a monitor is opened, its members are added, then it is closed. Every call returns the node.
+    std::size_t beginMonitor()
+    {
+        std::size_t node = nodes_.size();
+        nodes_.push_back(Node{MemberKind::Monitor, 0, 0});
+        openMonitors_.push_back(static_cast<std::uint32_t>(node));
+        return node;
+    }
+    void endMonitor()
+    {
+        nodes_[openMonitors_.back()].subtreeEnd = static_cast<std::uint32_t>(nodes_.size());
+        openMonitors_.pop_back();
+    }
+    std::size_t add(const CEO& member)
+    {
+        ceos_.push_back(member);
+        return appendLeaf(MemberKind::CEO, ceos_.size() - 1);
+    }
+    std::size_t add(const HeadOfDepartament& member)
+    {
+        heads_.push_back(member);
+        return appendLeaf(MemberKind::HeadOfDepartament, heads_.size() - 1);
+    }
+    std::size_t add(const SectorManager& member)
+    {
+        sectorManagers_.push_back(member);
+        return appendLeaf(MemberKind::SectorManager, sectorManagers_.size() - 1);
+    }
+    std::size_t add(const TeamLeader& member)
+    {
+        teamLeaders_.push_back(member);
+        return appendLeaf(MemberKind::TeamLeader, teamLeaders_.size() - 1);
+    }
+    // Not owned, has to outlive the company
+    std::size_t addForeign(CompanyMember* member)
+    {
+        foreign_.push_back(member);
+        return appendLeaf(MemberKind::Foreign, foreign_.size() - 1);
+    }
+
+    /// @brief Appends a copy of a pointer tree. Nested monitors become monitor nodes, the known member classes are copied
+    /// by value, anything else is kept by pointer.
+    /// @return The node of the root.
+    std::size_t append(CompanyMember* member)
+    {
+        if(MembersMonitor* monitor = dynamic_cast<MembersMonitor*>(member))
+        {
+            std::size_t node = beginMonitor();
+            for(CompanyMember* child : monitor->members())
+            {
+                append(child);
+            }
+            endMonitor();
+            return node;
+        }
+        // Exact classes only, a copy of a class derived from them would lose its overrides
+        const std::type_info& type = typeid(*member);
+        if(type == typeid(TeamLeader)) { return add(*static_cast<TeamLeader*>(member)); }
+        if(type == typeid(SectorManager)) { return add(*static_cast<SectorManager*>(member)); }
+        if(type == typeid(HeadOfDepartament)) { return add(*static_cast<HeadOfDepartament*>(member)); }
+        if(type == typeid(CEO)) { return add(*static_cast<CEO*>(member)); }
+        return addForeign(member);
+    }
+
+    std::size_t size() const { return nodes_.size(); }
+    const Node& node(std::size_t node) const { return nodes_[node]; }
+    // The children of a monitor: the first one follows it, every next one starts where the previous subtree ends.
+    std::size_t firstChild(std::size_t node) const { return node + 1; }
+    std::size_t nextSibling(std::size_t node) const { return nodes_[node].subtreeEnd; }
+
+    // Performs the action on every member of the nodes [begin, end), in node order.
+    void perform(std::size_t begin, std::size_t end, MemberAction action)
+    {
+        for(std::size_t i = begin; i < end; ++i)
+        {
+            const Node& current = nodes_[i];
+            switch(current.kind)
+            {
+                case MemberKind::Monitor: break;
+                case MemberKind::CEO: performOn(ceos_[current.index], action); break;
+                case MemberKind::HeadOfDepartament: performOn(heads_[current.index], action); break;
+                case MemberKind::SectorManager: performOn(sectorManagers_[current.index], action); break;
+                case MemberKind::TeamLeader: performOn(teamLeaders_[current.index], action); break;
+                case MemberKind::Foreign:
+                    switch(action)
+                    {
+                        case MemberAction::PresentSelf: foreign_[current.index]->presentSelf(); break;
+                        case MemberAction::Work: foreign_[current.index]->work(); break;
+                        case MemberAction::TakeBreak: foreign_[current.index]->takeBreak(); break;
+                    }
+                    break;
+            }
+        }
+    }
+
+    // Whole subtree operations, in the same order as MembersMonitor visits them
+    void presentSelf(std::size_t node) { perform(node, nodes_[node].subtreeEnd, MemberAction::PresentSelf); }
+    void work(std::size_t node) { perform(node, nodes_[node].subtreeEnd, MemberAction::Work); }
+    void takeBreak(std::size_t node) { perform(node, nodes_[node].subtreeEnd, MemberAction::TakeBreak); }
+};
+
+// Composite facade over one subtree of a FlatCompany
+class FlatMembersMonitor : public CompanyMember
+{
+    private:
+    FlatCompany* company_;
+    std::size_t node_;
+    public:
+    FlatMembersMonitor(FlatCompany* company, std::size_t node) : company_(company), node_(node) {}
+    void presentSelf() override { company_->presentSelf(node_); }
+    void work() override { company_->work(node_); }
+    void takeBreak() override { company_->takeBreak(node_); }
+};
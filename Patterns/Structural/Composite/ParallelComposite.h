@@ -0,0 +1,134 @@
+/**
+ * Parallel execution of whole subtree operations of a FlatCompany. The subtree is split into tasks - subtrees of at
+ * most grain nodes, and runs of small sibling subtrees merged up to grain nodes - so small teams never become a task of
+ * their own. The tasks run on a WorkStealingPool, each one with its members talking into a buffer of its own, and the
+ * buffers are written out in tree order, so the log reads exactly as if the members were visited one after another.
+ * The order holds for what the members write to memberLog() - a member writing to std::cout directly (a Foreign one, for
+ * example) bypasses the buffers and comes out whenever its task runs.
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ */
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+#include "Composite.h"
+#include "FlatComposite.h"
+#include "../Bridge/WorkStealingPool.h"
+
+// Points memberLog() of the current thread to another stream, until it goes out of scope.
+class MemberLogRedirect
+{
+    private:
+    std::ostream* previous_;
+    public:
+    explicit MemberLogRedirect(std::ostream& target) : previous_(std::exchange(memberLogTarget(), &target)) {}
+    MemberLogRedirect(const MemberLogRedirect&) = delete;
+    MemberLogRedirect& operator=(const MemberLogRedirect&) = delete;
+    ~MemberLogRedirect() { memberLogTarget() = previous_; }
+};
+
+class ParallelMembersExecutor
+{
+    public:
+    using Task = std::pair<std::size_t, std::size_t>;     // Node range [first, second)
+    static constexpr std::size_t DefaultGrain = 4096;
+    static constexpr std::size_t TasksPerFlush = 256;    // Bounds the log held in memory at once
+
+    private:
+    FlatCompany* company_;
+    WorkStealingPool* pool_;
+    std::size_t grain_;
+
+    void split(std::size_t node, std::vector<Task>& tasks) const
+    {
+        std::size_t end = company_->nextSibling(node);
+        if(end - node <= grain_)
+        {
+            tasks.emplace_back(node, end);
+            return;
+        }
+        // The monitor node itself does nothing, its children are split further
+        std::size_t runBegin = company_->firstChild(node);
+        for(std::size_t child = runBegin; child < end; child = company_->nextSibling(child))
+        {
+            std::size_t childEnd = company_->nextSibling(child);
+            if(childEnd - child > grain_)
+            {
+                if(runBegin < child) { tasks.emplace_back(runBegin, child); }
+                split(child, tasks);
+                runBegin = childEnd;
+            }
+            else if(childEnd - runBegin > grain_)
+            {
+                tasks.emplace_back(runBegin, child);
+                runBegin = child;
+            }
+        }
+        if(runBegin < end) { tasks.emplace_back(runBegin, end); }
+    }
+
+    void run(std::size_t node, FlatCompany::MemberAction action)
+    {
+        std::vector<Task> tasks = this->tasks(node);
+        std::ostream& log = memberLog();
+        std::vector<std::string> logs;
+        for(std::size_t first = 0; first < tasks.size(); first += TasksPerFlush)
+        {
+            std::size_t count = std::min(TasksPerFlush, tasks.size() - first);
+            logs.assign(count, std::string());
+            pool_->parallelFor(count, 1, [this, &tasks, &logs, first, action](std::size_t begin, std::size_t end)
+            {
+                for(std::size_t i = begin; i < end; ++i)
+                {
+                    std::ostringstream buffer;
+                    {
+                        MemberLogRedirect redirect(buffer);
+                        company_->perform(tasks[first + i].first, tasks[first + i].second, action);
+                    }
+                    logs[i] = buffer.str();
+                }
+            });
+            for(const std::string& text : logs)
+            {
+                log << text;
+            }
+        }
+    }
+
+    public:
+    // A grain of 0 would split down to empty runs, it is taken as 1
+    ParallelMembersExecutor(FlatCompany* company, WorkStealingPool* pool, std::size_t grain = DefaultGrain) :
+    company_(company), pool_(pool), grain_(std::max<std::size_t>(grain, 1)) {}
+
+    // The tasks a subtree is split into, in tree order.
+    std::vector<Task> tasks(std::size_t node) const
+    {
+        std::vector<Task> result;
+        split(node, result);
+        return result;
+    }
+
+    void presentSelf(std::size_t node) { run(node, FlatCompany::MemberAction::PresentSelf); }
+    void work(std::size_t node) { run(node, FlatCompany::MemberAction::Work); }
+    void takeBreak(std::size_t node) { run(node, FlatCompany::MemberAction::TakeBreak); }
+};
+
+// Composite facade running one subtree in parallel
+class ParallelMembersMonitor : public CompanyMember
+{
+    private:
+    ParallelMembersExecutor* executor_;
+    std::size_t node_;
+    public:
+    ParallelMembersMonitor(ParallelMembersExecutor* executor, std::size_t node) : executor_(executor), node_(node) {}
+    void presentSelf() override { executor_->presentSelf(node_); }
+    void work() override { executor_->work(node_); }
+    void takeBreak() override { executor_->takeBreak(node_); }
+};
@@ -0,0 +1,317 @@
+// Benchmarks of the Composite hot calls: whole tree traversal through MembersMonitor, through the flattened tree, and
+// through the flattened tree split over a thread pool, the payroll and headcount kept up to date on every monitor, and
+// regrouping a whole company into team monitors.
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <string>
+#include <typeinfo>
+#include <vector>
+#include "Composite.h"
+#include "FlatComposite.h"
+#include "ParallelComposite.h"
+#include "QuietOutput.h"
+
+// Builds a company of state.range(0) team leaders split into nested monitors, one per sector.
+static void benchWork(benchmark::State& state)
+{
+    QuietOutput quiet;
+    const int memberCount = static_cast<int>(state.range(0));
+    const int sectorSize = 16;
+    std::vector<CompanyMember*> owned;
+    MembersMonitor company;
+    MembersMonitor* sector = nullptr;
+    for(int i = 0; i < memberCount; ++i)
+    {
+        if(i % sectorSize == 0)
+        {
+            sector = new MembersMonitor;
+            owned.push_back(sector);
+            company.add(sector);
+        }
+        CompanyMember* member = new TeamLeader("Member " + std::to_string(i), "01-01-2020", 150000, "Development", "Improvement", "Bumble Bee");
+        owned.push_back(member);
+        sector->add(member);
+    }
+
+    for(auto _ : state)
+    {
+        company.work();
+    }
+    state.SetItemsProcessed(state.iterations() * memberCount);
+
+    for(auto member : owned)
+    {
+        delete member;
+    }
+}
+BENCHMARK(benchWork)->Arg(1 << 10)->Arg(1 << 14);
+
+// Company of about memberCount members: departments of 10 sectors, sectors of 100 team leaders, each group led by its
+// head or manager. Every node ends up in owned, the root included.
+// The team leaders are hired in random order, so like in a long running program they are spread over the heap instead
+// of following each other in tree order.
+static MembersMonitor* buildCompany(int memberCount, std::vector<CompanyMember*>& owned)
+{
+    std::vector<int> hiringOrder(memberCount);
+    std::iota(hiringOrder.begin(), hiringOrder.end(), 0);
+    std::shuffle(hiringOrder.begin(), hiringOrder.end(), std::mt19937(2023));
+    std::vector<CompanyMember*> members(memberCount);
+    for(int i : hiringOrder)
+    {
+        members[i] = new TeamLeader("Member " + std::to_string(i), "01-01-2020", 150000, "Development", "Improvement", "Bumble Bee");
+        owned.push_back(members[i]);
+    }
+
+    MembersMonitor* company = new MembersMonitor;
+    owned.push_back(company);
+    CompanyMember* ceo = new CEO("Pierce Morgan", "10-04-2011", 3253200);
+    owned.push_back(ceo);
+    company->add(ceo);
+    MembersMonitor* departament = nullptr;
+    MembersMonitor* sector = nullptr;
+    for(int i = 0; i < memberCount; ++i)
+    {
+        if(i % 1000 == 0)
+        {
+            departament = new MembersMonitor;
+            owned.push_back(departament);
+            company->add(departament);
+            CompanyMember* head = new HeadOfDepartament("Head " + std::to_string(i / 1000), "25-02-2010", 654000, "Development");
+            owned.push_back(head);
+            departament->add(head);
+        }
+        if(i % 100 == 0)
+        {
+            sector = new MembersMonitor;
+            owned.push_back(sector);
+            departament->add(sector);
+            CompanyMember* manager = new SectorManager("Manager " + std::to_string(i / 100), "16-07-2019", 243320, "Development", "Improvement");
+            owned.push_back(manager);
+            sector->add(manager);
+        }
+        sector->add(members[i]);
+    }
+    return company;
+}
+
+// Whole company work() at 1M nodes, through the pointer tree and through the flattened copy of it.
+static const int bigCompanySize = 1000000;
+
+static void benchWorkPointerTree(benchmark::State& state)
+{
+    QuietOutput quiet;
+    std::vector<CompanyMember*> owned;
+    MembersMonitor* company = buildCompany(bigCompanySize, owned);
+    for(auto _ : state)
+    {
+        company->work();
+    }
+    state.SetItemsProcessed(state.iterations() * owned.size());
+    for(auto member : owned)
+    {
+        delete member;
+    }
+}
+BENCHMARK(benchWorkPointerTree)->Unit(benchmark::kMillisecond);
+
+static void benchWorkFlat(benchmark::State& state)
+{
+    QuietOutput quiet;
+    FlatCompany flat;
+    {
+        std::vector<CompanyMember*> owned;
+        flat.append(buildCompany(bigCompanySize, owned));
+        for(auto member : owned)
+        {
+            delete member;
+        }
+    }
+    FlatMembersMonitor company(&flat, 0);
+    for(auto _ : state)
+    {
+        company.work();
+    }
+    state.SetItemsProcessed(state.iterations() * flat.size());
+}
+BENCHMARK(benchWorkFlat)->Unit(benchmark::kMillisecond);
+
+// 100k random updates on a 1M member company - nine in ten a raise, one in ten a team leader moving to another sector -
+// each followed by a payroll and a headcount query.
+static void benchAggregateUpdates(benchmark::State& state)
+{
+    std::vector<CompanyMember*> owned;
+    MembersMonitor* company = buildCompany(bigCompanySize, owned);
+    std::vector<TeamLeader*> leaders;
+    std::vector<MembersMonitor*> sectors;
+    std::vector<std::size_t> sectorOf;
+    for(CompanyMember* member : owned)
+    {
+        MembersMonitor* monitor = dynamic_cast<MembersMonitor*>(member);
+        if(!monitor || monitor == company) { continue; }
+        // Sectors are the monitors that start with their manager
+        if(typeid(*monitor->members().front()) == typeid(SectorManager))
+        {
+            std::size_t sector = sectors.size();
+            sectors.push_back(monitor);
+            for(CompanyMember* child : monitor->members())
+            {
+                if(typeid(*child) == typeid(TeamLeader))
+                {
+                    leaders.push_back(static_cast<TeamLeader*>(child));
+                    sectorOf.push_back(sector);
+                }
+            }
+        }
+    }
+
+    std::mt19937 random(11);
+    std::uniform_int_distribution<std::size_t> pickLeader(0, leaders.size() - 1);
+    std::uniform_int_distribution<std::size_t> pickSector(0, sectors.size() - 1);
+    std::uniform_int_distribution<int> pickSalary(100000, 200000);
+    const int updates = 100000;
+    for(auto _ : state)
+    {
+        long long payroll = 0;
+        std::size_t headcount = 0;
+        for(int i = 0; i < updates; ++i)
+        {
+            std::size_t leader = pickLeader(random);
+            if(i % 10 == 0)
+            {
+                std::size_t target = pickSector(random);
+                sectors[sectorOf[leader]]->remove(leaders[leader]);
+                sectors[target]->add(leaders[leader]);
+                sectorOf[leader] = target;
+            }
+            else
+            {
+                leaders[leader]->setSalary(pickSalary(random));
+            }
+            payroll += company->totalSalary();
+            headcount += sectors[sectorOf[leader]]->headcount();
+        }
+        benchmark::DoNotOptimize(payroll);
+        benchmark::DoNotOptimize(headcount);
+    }
+    state.SetItemsProcessed(state.iterations() * updates);
+    if(!company->checkAggregates()) { state.SkipWithError("Aggregates out of step with the tree"); }
+
+    for(auto member : owned)
+    {
+        delete member;
+    }
+}
+BENCHMARK(benchAggregateUpdates)->Unit(benchmark::kMillisecond);
+
+// Payroll recounted from every leaf, what a query cost before the totals were kept.
+static void benchAggregateRecount(benchmark::State& state)
+{
+    std::vector<CompanyMember*> owned;
+    MembersMonitor* company = buildCompany(bigCompanySize, owned);
+    for(auto _ : state)
+    {
+        benchmark::DoNotOptimize(company->checkAggregates());
+    }
+    for(auto member : owned)
+    {
+        delete member;
+    }
+}
+BENCHMARK(benchAggregateRecount)->Unit(benchmark::kMillisecond);
+
+// state.range(0) team leaders in teams of 100, half of them in each departament.
+static std::vector<std::unique_ptr<TeamLeader>> hireTeams(int memberCount)
+{
+    std::vector<std::unique_ptr<TeamLeader>> people;
+    people.reserve(memberCount);
+    for(int i = 0; i < memberCount; ++i)
+    {
+        // Consecutive hires end up in different teams
+        int team = i % (memberCount / 100);
+        people.emplace_back(new TeamLeader("Member " + std::to_string(i), "01-01-2020", 150000, team % 2 ? "Innovation" : "Development",
+                                           "Sector " + std::to_string(team / 10), "Team " + std::to_string(team)));
+    }
+    return people;
+}
+
+// ClientClass::combineCompanySelection on a company of state.range(0) members, selecting a whole departament: half of
+// the members leave the company one by one for a new monitor, everyone presents themselves and the selection becomes
+// the company. The selection is looked up in the index before the timing starts, so the index of the company follows
+// every move - the new monitor joining it brings its whole selection back into the index.
+static void benchCombineCompanySelection(benchmark::State& state)
+{
+    QuietOutput quiet;
+    const int memberCount = static_cast<int>(state.range(0));
+    std::vector<std::unique_ptr<TeamLeader>> people = hireTeams(memberCount);
+    std::vector<CompanyMember*> everyone;
+    for(auto& person : people) { everyone.push_back(person.get()); }
+    for(auto _ : state)
+    {
+        state.PauseTiming();
+        {
+            ClientClass client(new MembersMonitor);
+            client.loadCompany(everyone);
+            std::vector<CompanyMember*> selection = client.companySurvailanceProgram_->departament("Development");
+            state.ResumeTiming();
+
+            client.combineCompanySelection(selection);
+            benchmark::DoNotOptimize(client.companySurvailanceProgram_->headcount());
+            state.PauseTiming();
+        }
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * memberCount / 2);
+}
+BENCHMARK(benchCombineCompanySelection)->Arg(10000)->Arg(50000)->Arg(1000000)->Unit(benchmark::kMillisecond);
+
+// Synthetic company of 5M team leaders, built once and shared by every thread count.
+static FlatCompany& hugeCompany()
+{
+    static FlatCompany* company = []()
+    {
+        FlatCompany* flat = new FlatCompany;
+        const int memberCount = 5000000;
+        flat->beginMonitor();
+        flat->add(CEO("Pierce Morgan", "10-04-2011", 3253200));
+        for(int i = 0; i < memberCount; i += 100)
+        {
+            if(i % 1000 == 0)
+            {
+                if(i > 0) { flat->endMonitor(); }
+                flat->beginMonitor();
+                flat->add(HeadOfDepartament("Head " + std::to_string(i / 1000), "25-02-2010", 654000, "Development"));
+            }
+            flat->beginMonitor();
+            flat->add(SectorManager("Manager " + std::to_string(i / 100), "16-07-2019", 243320, "Development", "Improvement"));
+            for(int j = i; j < i + 100; ++j)
+            {
+                flat->add(TeamLeader("Member " + std::to_string(j), "01-01-2020", 150000, "Development", "Improvement", "Bumble Bee"));
+            }
+            flat->endMonitor();
+        }
+        flat->endMonitor();
+        flat->endMonitor();
+        return flat;
+    }();
+    return *company;
+}
+
+// Whole company work() on state.range(0) threads, the log still comes out in tree order.
+static void benchParallelWork(benchmark::State& state)
+{
+    QuietOutput quiet;
+    FlatCompany& company = hugeCompany();
+    WorkStealingPool pool(static_cast<std::size_t>(state.range(0)));
+    ParallelMembersExecutor executor(&company, &pool);
+    for(auto _ : state)
+    {
+        executor.work(0);
+    }
+    state.SetItemsProcessed(state.iterations() * company.size());
+}
+BENCHMARK(benchParallelWork)->RangeMultiplier(2)->Range(1, 32)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+BENCHMARK_MAIN();
@@ -10,212 +10,119 @@
 #include <vector>
 #include <string>
 #include <algorithm>
+#include "Composite.h"
+#include "FlatComposite.h"
+#include "ParallelComposite.h"
 
-// Common interface
-class CompanyMember
-{
-    public:
-    virtual void presentSelf() = 0;
-    virtual void work() = 0;
-    virtual void takeBreak() = 0;
-    virtual ~CompanyMember() {}
-};
-
-// Leafs
-class CEO : public CompanyMember
+const std::vector<CompanyMember*> pearCompany = 
 {
-    protected:
-    std::string startingDate_;
-    int salary_;
-    public:
-    std::string name_;
-    CEO(std::string name, std::string startDate, int salary) : startingDate_(startDate), salary_(salary), name_(name) {}
-    void presentSelf() override
-    {
-        std::cout << "I am " << this->name_ << ". I am a CEO of this company since " << this->startingDate_ << std::endl;
-    }
-    void work() override
-    {
-        std::cout << this->name_ << " points towards the direction of where the company is going. - He has a lot of meetings developing a new strategies " << std::endl;
-    }
-    void takeBreak() override
-    {
-        std::cout << this->name_ << " goes on a trip to a tropical island of Janmayen, to refresh his mind." << std::endl;
-    }
+    new CEO              ("Pierce Morgan",   "10-04-2011", 3253200),
+    new HeadOfDepartament("Mark Cucumber",   "25-02-2010", 654000, "Innovation"),
+    new HeadOfDepartament("Melinda Brown",   "28-02-2001", 654000, "Development"),
+    new SectorManager    ("Rajesh Mulvai",   "13-04-2015", 243320, "Innovation",  "Future product interation"),
+    new SectorManager    ("Betty Wise",      "16-07-2019", 243320, "Innovation",  "AI functionality"),
+    new SectorManager    ("Berta Buldga",    "20-01-2022", 251320, "Development", "Maintnance"),
+    new SectorManager    ("Henry Yugene",    "30-06-2021", 235630, "Development", "Improvement"),
+    new TeamLeader       ("George Beaver",   "12-08-2020", 154240, "Innovation",  "Future product iteration", "Fast Foxes"),
+    new TeamLeader       ("Dora Cheems",     "10-02-2001", 201240, "Innovation",  "AI functionality",         "Artificial Hamster"),
+    new TeamLeader       ("Benjamin Oakley", "14-02-2005", 193050, "Innovation",  "AI functionality",         "Hardy Tortoise"),
+    new TeamLeader       ("Veronica Blank",  "20-12-2009", 180320, "Development", "Maintanance",              "Pedantic Cat"),
+    new TeamLeader       ("Mathew White",    "02-06-2010", 179900, "Development", "Improvement",              "Robotic Pigeon"),
+    new TeamLeader       ("Alex Twain",      "05-03-2000", 202150, "Development", "Improvement",              "Bumble Bee")
 };
 
-class HeadOfDepartament : public CEO
+void flatClientCode(const std::vector<CompanyMember*>& company)
 {
-    protected:
-    std::string departamentAssigned_;
-    public:
-    HeadOfDepartament(std::string name, std::string startDate, int salary, std::string departament) : CEO(name, startDate, salary), departamentAssigned_(departament) {}
-    void presentSelf() override 
-    {
-        std::cout << "My name is " << this->name_ << ". I am head of the " << departamentAssigned_ << " departament. I work here since " << startingDate_ << std::endl;
-    }
-    void work() override
+    // The innovation departament as its own monitor, inside the whole company
+    MembersMonitor innovation;
+    MembersMonitor everyone;
+    everyone.add(company[0]);
+    everyone.add(&innovation);
+    for(int i : {1, 3, 4, 7, 8, 9})
     {
-        std::cout << this->name_ << " tries to develop the best strategy in departament of " << departamentAssigned_ << " in order to aquire the best quaterly result. " << std::endl;
+        innovation.add(company[i]);
     }
-    void takeBreak() override
-    {
-        std::cout << this->name_ << " spends some time with his colleagues on a golf club! " << std::endl;
-    }
-
-};
 
-class SectorManager : public HeadOfDepartament
-{
-    protected:
-    std::string sectorAssigned_;
-    public:
-    SectorManager(std::string name, std::string startDate, int salary, std::string departament, std::string sector) :
-    HeadOfDepartament(name, startDate, salary, departament), sectorAssigned_(sector) {}
-    void presentSelf() override
-    {
-        std::cout << this->name_ << " here. I am a manager at " << this->sectorAssigned_ << "sector, in " << this->departamentAssigned_ <<". I work here since " << this->startingDate_ << std::endl;
-    }
-    void work() override
-    {
-        std::cout << this->name_ << " cooridinates team leaders in his sector so that each feature/service will be delivered on time." << std::endl;
-    }
-    void takeBreak() override
-    {
-        std::cout << this->name_ << " travles into a different country via plane or train." << std::endl;
-    }
-};
+    // One array of nodes instead of the pointer tree, the monitors are used the same way
+    FlatCompany flat;
+    std::size_t root = flat.append(&everyone);
+    std::size_t innovationNode = flat.nextSibling(flat.firstChild(root));
+    FlatMembersMonitor flatInnovation(&flat, innovationNode);
+    std::cout << "-=========================-" << std::endl;
+    std::cout << "Flattened innovation departament" << std::endl;
+    std::cout << "-=========================-" << std::endl;
+    flatInnovation.work();
 
-class TeamLeader : public SectorManager
-{
-    protected: 
-    std::string teamAssigned_;
-    public:
-    TeamLeader(std::string name, std::string startDate, int salary, std::string departament, std::string sector, std::string team) : SectorManager(name, startDate, salary, departament, sector), teamAssigned_(team) {}
-    void presentSelf() override
-    {
-        std::cout << "Hi! My name is " << this->name_ << " lead my team to deliver the best quality feature! I work in team " << this->teamAssigned_ << " at sector " << this->sectorAssigned_ << " in " << this->departamentAssigned_ << " departament. I also work here since " << this->startingDate_ << std::endl; 
-    }
-    void work() override
-    {
-        std::cout << this->name_ << " organizes meeting for his team, as well as helping them to maintain the best atmosphere around." << std::endl;
-    }
-    void takeBreak() override
-    {
-        std::cout << this->name_ << " loves to have a good in a movie theater, and travel from time to time." << std::endl;
-    }
-};
+    // Whole company on 4 threads, in tasks of at most 2 nodes - still told in the order of the tree
+    WorkStealingPool pool(4);
+    ParallelMembersExecutor executor(&flat, &pool, 2);
+    ParallelMembersMonitor parallelCompany(&executor, root);
+    std::cout << "-=========================-" << std::endl;
+    std::cout << "Whole company on holiday, " << executor.tasks(root).size() << " tasks" << std::endl;
+    std::cout << "-=========================-" << std::endl;
+    parallelCompany.takeBreak();
+}
 
-// Composite
-class MembersMonitor : public CompanyMember
+void payrollClientCode(const std::vector<CompanyMember*>& company)
 {
-    private:
-    std::vector<CompanyMember*> members_;
-    public:
-    // Manipulate data container.
-    void add(CompanyMember* newMember) { members_.push_back(newMember); }
-    void remove(CompanyMember* removeMember) 
-    { 
-        //Find member
-        auto it = std::find(members_.begin(), members_.end(), removeMember);
-        // Remove if present
-        if(it != members_.end())
-        {
-            members_.erase(members_.begin());
-            return;
-        }
-    }
-
-    void removeAll()
+    // Totals are kept by the monitors, reading them does not walk the tree
+    MembersMonitor innovation;
+    MembersMonitor development;
+    MembersMonitor everyone;
+    for(int i : {1, 3, 4, 7, 8, 9})
     {
-        members_.clear();
-    }
-    // Force every employee from within members_ to do specific task
-    void presentSelf() override
-    {
-        for(auto member : members_)
-        {
-            member->presentSelf();
-        }
+        innovation.add(company[i]);
     }
-    void work() override
+    for(int i : {2, 5, 6, 10, 11, 12})
     {
-        for(auto member : members_)
-        {
-            member->work();
-        }
-    }
-    void takeBreak() override
-    {
-        for(auto member : members_)
-        {
-            member->takeBreak();
-        }
+        development.add(company[i]);
     }
-};
+    everyone.add(company[0]);
+    everyone.add(&innovation);
+    everyone.add(&development);
 
-// Client code
-class ClientClass
+    std::cout << "-=========================-" << std::endl;
+    std::cout << "Payroll" << std::endl;
+    std::cout << "-=========================-" << std::endl;
+    std::cout << "Company: " << everyone.headcount() << " people, " << everyone.totalSalary() << " in salaries" << std::endl;
+    std::cout << "Innovation: " << innovation.headcount() << " people, " << innovation.totalSalary() << " in salaries" << std::endl;
+    // The index of the company covers the members of the nested monitors too
+    std::cout << "AI functionality: " << everyone.sector("AI functionality").size() << " people, all of them in innovation" << std::endl;
+
+    // A raise and a transfer reach every monitor above the member
+    TeamLeader* dora = static_cast<TeamLeader*>(company[8]);
+    dora->setSalary(dora->getSalary() + 20000);
+    innovation.remove(company[9]);
+    development.add(company[9]);
+    std::cout << "After a raise and a transfer: innovation " << innovation.headcount() << " people, " << innovation.totalSalary()
+              << " in salaries, company " << everyone.totalSalary() << std::endl;
+    std::cout << "Totals " << (everyone.checkAggregates() ? "match" : "do not match") << " the members" << std::endl;
+    std::cout << "Hardy Tortoise, found in the company after the transfer:" << std::endl;
+    for(auto member : everyone.team("Hardy Tortoise"))
+    {
+        member->presentSelf();
+    }
+}
+
+void indexClientCode(const std::vector<CompanyMember*>& company)
 {
-    public:
-    MembersMonitor* companySurvailanceProgram_;
-
-    ClientClass(MembersMonitor* csp) : companySurvailanceProgram_(csp) {}
-
-    void loadCompany(std::vector<CompanyMember*> loadMembers)
-    {
-        for(auto member : loadMembers)
-        {
-            companySurvailanceProgram_->add(member);
-        }
-    }
-
-    void survailance()
+    // The monitor indexes its members, a sector or a team is found without going through everyone
+    MembersMonitor everyone;
+    for(auto member : company)
     {
-        std::cout << "From January untill June & September to December this year: " << std::endl;
-        companySurvailanceProgram_->work();
-        std::cout << "Remainder of this year" << std::endl;
-        companySurvailanceProgram_->takeBreak();
+        everyone.add(member);
     }
-
-    void combineCompanySelection(std::vector<CompanyMember*> newCompany)
+    std::cout << "-=========================-" << std::endl;
+    std::cout << "AI functionality sector" << std::endl;
+    std::cout << "-=========================-" << std::endl;
+    for(auto member : everyone.sector("AI functionality"))
     {
-        MembersMonitor* advancedCSP = new MembersMonitor;
-        for(auto member : newCompany)
-        {
-            advancedCSP->add(member);
-            companySurvailanceProgram_->remove(member); 
-        }
-        
-        companySurvailanceProgram_->add(advancedCSP);
-        companySurvailanceProgram_->presentSelf();
-        delete advancedCSP;
-        
-        // Here is a little work around - so we can keep the original newCopmany vector values after advancedCSP has been removed
-        delete companySurvailanceProgram_;
-        companySurvailanceProgram_ = new MembersMonitor;
-        this->loadCompany(newCompany);
+        member->presentSelf();
     }
-
-    ~ClientClass() { std::cout << "Deleting client Class" << std::endl; delete companySurvailanceProgram_; }
-};
-
-const std::vector<CompanyMember*> pearCompany = 
-{
-    new CEO              ("Pierce Morgan",   "10-04-2011", 3253200),
-    new HeadOfDepartament("Mark Cucumber",   "25-02-2010", 654000, "Innovation"),
-    new HeadOfDepartament("Melinda Brown",   "28-02-2001", 654000, "Development"),
-    new SectorManager    ("Rajesh Mulvai",   "13-04-2015", 243320, "Innovation",  "Future product interation"),
-    new SectorManager    ("Betty Wise",      "16-07-2019", 243320, "Innovation",  "AI functionality"),
-    new SectorManager    ("Berta Buldga",    "20-01-2022", 251320, "Development", "Maintnance"),
-    new SectorManager    ("Henry Yugene",    "30-06-2021", 235630, "Development", "Improvement"),
-    new TeamLeader       ("George Beaver",   "12-08-2020", 154240, "Innovation",  "Future product iteration", "Fast Foxes"),
-    new TeamLeader       ("Dora Cheems",     "10-02-2001", 201240, "Innovation",  "AI functionality",         "Artificial Hamster"),
-    new TeamLeader       ("Benjamin Oakley", "14-02-2005", 193050, "Innovation",  "AI functionality",         "Hardy Tortoise"),
-    new TeamLeader       ("Veronica Blank",  "20-12-2009", 180320, "Development", "Maintanance",              "Pedantic Cat"),
-    new TeamLeader       ("Mathew White",    "02-06-2010", 179900, "Development", "Improvement",              "Robotic Pigeon"),
-    new TeamLeader       ("Alex Twain",      "05-03-2000", 202150, "Development", "Improvement",              "Bumble Bee")
-};
+    everyone.remove(company[0]);
+    std::cout << everyone.departament("Development").size() << " people in Development, " << everyone.team("Bumble Bee").size()
+              << " in team Bumble Bee, " << everyone.headcount() << " without the CEO" << std::endl;
+}
 
 int main()
 {
@@ -249,6 +156,15 @@ int main()
     // Cleanup
     delete secPlus;
 
+    // Flattened tree
+    flatClientCode(pearCompany);
+
+    // Payroll and headcount
+    payrollClientCode(pearCompany);
+
+    // Group lookups
+    indexClientCode(pearCompany);
+
     for(auto member : pearCompany)
     {
         if(member)
@@ -0,0 +1,30 @@
+// Benchmarks of the Decorator hot calls: plain and decorated Dog calls.
+#include <benchmark/benchmark.h>
+#include "Decorator.h"
+
+static void benchConcreteDog(benchmark::State& state)
+{
+    ConcreteDog dog;
+    Dog* target = &dog;
+    for(auto _ : state)
+    {
+        benchmark::DoNotOptimize(target->play());
+        benchmark::DoNotOptimize(target->retrieve(50));
+    }
+}
+BENCHMARK(benchConcreteDog);
+
+static void benchDecoratedDog(benchmark::State& state)
+{
+    ConcreteDog dog;
+    CircusDogDecorator decorated(&dog);
+    Dog* target = &decorated;
+    for(auto _ : state)
+    {
+        benchmark::DoNotOptimize(target->play());
+        benchmark::DoNotOptimize(target->retrieve(50));
+    }
+}
+BENCHMARK(benchDecoratedDog);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,17 @@
+// Benchmarks of the Facade hot call: FullTravelBooking::fullBook.
+#include <benchmark/benchmark.h>
+#include "Facade.h"
+#include "QuietOutput.h"
+
+static void benchFullBook(benchmark::State& state)
+{
+    QuietOutput quiet;
+    FullTravelBooking booking;
+    for(auto _ : state)
+    {
+        booking.fullBook("London", "Cheap");
+    }
+}
+BENCHMARK(benchFullBook);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,37 @@
+// Benchmarks of the Flyweight hot call: ItemFactory::getItemType.
+#include <benchmark/benchmark.h>
+#include "Flyweight.h"
+
+static void benchGetItemTypeFirst(benchmark::State& state)
+{
+    ItemFactory factory;
+    for(auto _ : state)
+    {
+        benchmark::DoNotOptimize(factory.getItemType("Couch"));
+    }
+}
+BENCHMARK(benchGetItemTypeFirst);
+
+static void benchGetItemTypeLast(benchmark::State& state)
+{
+    ItemFactory factory;
+    for(auto _ : state)
+    {
+        benchmark::DoNotOptimize(factory.getItemType("Desk"));
+    }
+}
+BENCHMARK(benchGetItemTypeLast);
+
+static void benchCreateItem(benchmark::State& state)
+{
+    ItemFactory factory;
+    for(auto _ : state)
+    {
+        Item* item = new Item(12, 10, ItemStyle::modern, factory.getItemType("Bed"));
+        benchmark::DoNotOptimize(item);
+        delete item;
+    }
+}
+BENCHMARK(benchCreateItem);
+
+BENCHMARK_MAIN();
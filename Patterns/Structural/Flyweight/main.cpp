@@ -10,94 +10,7 @@
 #include <iostream>
 #include <string>
 #include <vector>
-
-enum ItemStyle
-{
-    artDeco = 0,
-    vintage = 1,
-    modern  = 2
-};
-
-// Unique state - mutable
-class ItemType
-{
-    public:
-    std::string name_;    // Or we can add a unique name to it
-    std::string texture_; // We can change texture of a given item
-    int value_;
-    ItemType(std::string name, std::string texture, int value) : name_(name), texture_(texture), value_(value) {}
-    void displayDetails()
-    {
-        std::cout << "This is " << this->name_ << ". It has " << this->texture_ << " texture. Cost: " << this->value_ << std::endl;
-    }
-};
-
-// Object creator
-class ItemFactory
-{
-    std::vector<ItemType*> listOfItems_;
-    public:
-    ItemFactory()
-    {
-        listOfItems_.push_back(new ItemType("Couch", "Comb", 250));
-        listOfItems_.push_back(new ItemType("Bed", "Cozy", 420));
-        listOfItems_.push_back(new ItemType("TV", "Smooth", 2400));
-        listOfItems_.push_back(new ItemType("Chair", "Sand Swirl", 25));
-        listOfItems_.push_back(new ItemType("Table", "Sand Swirl", 100));
-        listOfItems_.push_back(new ItemType("Plant", "Coarse", 10));
-        listOfItems_.push_back(new ItemType("Shelf", "Comb", 125));
-        listOfItems_.push_back(new ItemType("Door", "Smooth", 130));
-        listOfItems_.push_back(new ItemType("Desk", "Comb", 155));
-    }
-    ItemType* getItemType(std::string name) 
-    {
-        for( auto concreteItem : listOfItems_)
-        {
-            if(concreteItem->name_ == name)
-            {
-                return concreteItem;
-            }
-        }
-
-        std::cout << "No such item was found!" << std::endl;
-        return nullptr;
-    }
-    ~ItemFactory()
-    {
-        for(auto destroyItem : listOfItems_)
-        { delete destroyItem; }
-    }
-};
-
-// Repetetive state - not mutable
-class Item
-{
-    private:
-    int x_, y_;         // Once an item is placed it cannot be moved.
-    ItemStyle style_;   // If a style is choosen, no other style can be assign to this specific object.
-    ItemType* conItem_; // Gives refference to a unique item state
-    public:
-    Item(int coordX, int coordY, ItemStyle style, ItemType* type) : x_(coordX), y_(coordY), style_(style), conItem_(type) {}
-    void display()
-    {
-        std::cout <<"Location: " << this->x_ << ":" << this->y_ << std::endl;
-        std::cout <<"In style: ";
-        switch (this->style_)
-        {
-        case ItemStyle::artDeco:
-            std::cout << "art deco.";
-            break;
-        case ItemStyle::vintage:
-            std::cout << "vintage.";
-            break;
-        case ItemStyle::modern:
-            std::cout << "modern.";
-            break;
-        } 
-        std::cout<<std::endl;
-        this->conItem_->displayDetails();
-    }
-};
+#include "Flyweight.h"
 
 class ClientCodeRoom
 {
@@ -0,0 +1,49 @@
+// Benchmarks of the Proxy hot calls: requests going through ServerProxy compared to the real Server.
+#include <benchmark/benchmark.h>
+#include <string>
+#include "Proxy.h"
+#include "QuietOutput.h"
+
+static void benchServerShowEntry(benchmark::State& state)
+{
+    QuietOutput quiet;
+    Server server;
+    for(int i = 0; i < 64; ++i)
+    {
+        server.addEntry("Kid " + std::to_string(i), 5);
+    }
+    for(auto _ : state)
+    {
+        server.showEntry("Kid 32");
+    }
+}
+BENCHMARK(benchServerShowEntry);
+
+static void benchProxyShowEntry(benchmark::State& state)
+{
+    QuietOutput quiet;
+    // The proxy takes ownership of the server.
+    ServerProxy proxy(new Server);
+    for(int i = 0; i < 64; ++i)
+    {
+        proxy.addEntry("Kid " + std::to_string(i), 5);
+    }
+    for(auto _ : state)
+    {
+        proxy.showEntry("Kid 32");
+    }
+}
+BENCHMARK(benchProxyShowEntry);
+
+static void benchProxyRejectEntry(benchmark::State& state)
+{
+    QuietOutput quiet;
+    ServerProxy proxy(new Server);
+    for(auto _ : state)
+    {
+        proxy.addEntry("Mary", 12);
+    }
+}
+BENCHMARK(benchProxyRejectEntry);
+
+BENCHMARK_MAIN();